@@ -4,17 +4,21 @@
 #include <samurai/cell_array.hpp>
 #include <samurai/cell_list.hpp>
 
+// Cell list of one level: nested maps of forward lists or flat array sorted on conversion
+template <std::size_t dim>
+using map_cl_t = samurai::CellList<dim>;
+template <std::size_t dim>
+using flat_cl_t = typename samurai::CellArray<dim>::flat_cl_type;
+
+template <class cl_t>
 static void BM_CellListConstruction_2D(benchmark::State& state)
 {
-    constexpr std::size_t dim = 2;
-
     std::size_t min_level = 1;
     std::size_t max_level = 12;
 
-    samurai::CellList<dim> cl;
-
     for (auto _ : state)
     {
+        cl_t cl;
         for (std::size_t s = 0; s < state.range(0); ++s)
         {
             auto level = std::experimental::randint(min_level, max_level);
@@ -23,22 +27,22 @@ static void BM_CellListConstruction_2D(benchmark::State& state)
 
             cl[level][{y}].add_point(x);
         }
+        benchmark::DoNotOptimize(cl);
     }
 }
 
-BENCHMARK(BM_CellListConstruction_2D)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellListConstruction_2D, map_cl_t<2>)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellListConstruction_2D, flat_cl_t<2>)->Range(8, 8 << 18);
 
+template <class cl_t>
 static void BM_CellListConstruction_3D(benchmark::State& state)
 {
-    constexpr std::size_t dim = 3;
-
     std::size_t min_level = 1;
     std::size_t max_level = 12;
 
-    samurai::CellList<dim> cl;
-
     for (auto _ : state)
     {
+        cl_t cl;
         for (std::size_t s = 0; s < state.range(0); ++s)
         {
             auto level = std::experimental::randint(min_level, max_level);
@@ -48,11 +52,14 @@ static void BM_CellListConstruction_3D(benchmark::State& state)
 
             cl[level][{y, z}].add_point(x);
         }
+        benchmark::DoNotOptimize(cl);
     }
 }
 
-BENCHMARK(BM_CellListConstruction_3D)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellListConstruction_3D, map_cl_t<3>)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellListConstruction_3D, flat_cl_t<3>)->Range(8, 8 << 18);
 
+template <class cl_t>
 static void BM_CellList2CellArray_2D(benchmark::State& state)
 {
     constexpr std::size_t dim = 2;
@@ -60,7 +67,7 @@ static void BM_CellList2CellArray_2D(benchmark::State& state)
     std::size_t min_level = 1;
     std::size_t max_level = 12;
 
-    samurai::CellList<dim> cl;
+    cl_t cl;
     samurai::CellArray<dim> ca;
 
     for (std::size_t s = 0; s < state.range(0); ++s)
@@ -78,8 +85,10 @@ static void BM_CellList2CellArray_2D(benchmark::State& state)
     }
 }
 
-BENCHMARK(BM_CellList2CellArray_2D)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellList2CellArray_2D, map_cl_t<2>)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellList2CellArray_2D, flat_cl_t<2>)->Range(8, 8 << 18);
 
+template <class cl_t>
 static void BM_CellList2CellArray_3D(benchmark::State& state)
 {
     constexpr std::size_t dim = 3;
@@ -87,7 +96,7 @@ static void BM_CellList2CellArray_3D(benchmark::State& state)
     std::size_t min_level = 1;
     std::size_t max_level = 12;
 
-    samurai::CellList<dim> cl;
+    cl_t cl;
     samurai::CellArray<dim> ca;
 
     for (std::size_t s = 0; s < state.range(0); ++s)
@@ -106,4 +115,33 @@ static void BM_CellList2CellArray_3D(benchmark::State& state)
     }
 }
 
-BENCHMARK(BM_CellList2CellArray_3D)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellList2CellArray_3D, map_cl_t<3>)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellList2CellArray_3D, flat_cl_t<3>)->Range(8, 8 << 18);
+
+// Construction of the cell list and conversion to a cell array, as done when a mesh is built
+template <class cl_t>
+static void BM_CellListBuild_2D(benchmark::State& state)
+{
+    constexpr std::size_t dim = 2;
+
+    std::size_t min_level = 1;
+    std::size_t max_level = 12;
+
+    for (auto _ : state)
+    {
+        cl_t cl;
+        for (std::size_t s = 0; s < state.range(0); ++s)
+        {
+            auto level = std::experimental::randint(min_level, max_level);
+            auto x     = std::experimental::randint(0, (100 << level) - 1);
+            auto y     = std::experimental::randint(0, (100 << level) - 1);
+
+            cl[level][{y}].add_point(x);
+        }
+        samurai::CellArray<dim> ca = {cl};
+        benchmark::DoNotOptimize(ca);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_CellListBuild_2D, map_cl_t<2>)->Range(8, 8 << 18);
+BENCHMARK_TEMPLATE(BM_CellListBuild_2D, flat_cl_t<2>)->Range(8, 8 << 18);
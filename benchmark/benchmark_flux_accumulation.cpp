@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <samurai/bc.hpp>
+#include <samurai/field.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/schemes/fv.hpp>
+
+#ifdef SAMURAI_WITH_OPENMP
+#include <omp.h>
+#endif
+
+// Explicit application of the non-linear WENO5 Burgers flux on a uniform 2D mesh.
+// The first argument is the level of the mesh, the second one the number of threads.
+template <samurai::FluxAccumulation accumulation>
+void BM_NonLinearFluxAccumulation(benchmark::State& state)
+{
+    static constexpr std::size_t dim = 2;
+    using Config                     = samurai::MRConfig<dim, 3>;
+    using Box                        = samurai::Box<double, dim>;
+
+    auto level = static_cast<std::size_t>(state.range(0));
+#ifdef SAMURAI_WITH_OPENMP
+    omp_set_num_threads(static_cast<int>(state.range(1)));
+#endif
+
+    Box box({-1., -1.}, {1., 1.});
+    samurai::MRMesh<Config> mesh{box, level, level};
+
+    auto u = samurai::make_vector_field<dim>("u", mesh);
+    samurai::for_each_cell(mesh,
+                           [&](auto& cell)
+                           {
+                               u[cell][0] = cell.center(0) * cell.center(0) < 0.25 ? 1. : 0.;
+                               u[cell][1] = cell.center(1) * cell.center(1) < 0.25 ? 1. : 0.;
+                           });
+    samurai::make_bc<samurai::Dirichlet<3>>(u, 0., 0.);
+
+    auto conv = samurai::make_convection_weno5<decltype(u)>();
+    conv.flux_accumulation(accumulation);
+
+    for (auto _ : state)
+    {
+        auto flux = conv(u);
+        benchmark::DoNotOptimize(flux);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * mesh.nb_cells(decltype(mesh)::mesh_id_t::cells)));
+}
+
+BENCHMARK_TEMPLATE(BM_NonLinearFluxAccumulation, samurai::FluxAccumulation::Atomic)
+    ->ArgsProduct({{8, 10}, benchmark::CreateRange(1, 64, 2)})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_NonLinearFluxAccumulation, samurai::FluxAccumulation::Binned)
+    ->ArgsProduct({{8, 10}, benchmark::CreateRange(1, 64, 2)})
+    ->UseRealTime();
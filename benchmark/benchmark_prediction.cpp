@@ -0,0 +1,73 @@
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <samurai/arguments.hpp>
+#include <samurai/bc.hpp>
+#include <samurai/field.hpp>
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/mr/operators.hpp>
+#include <samurai/numeric/prediction.hpp>
+
+// Prediction of the ghosts (update_ghost_mr) and computation of the details of a 2D field with
+// 4 components, on a mesh adapted to a disc (levels [level - 4, level]): with the generic
+// expressions (first template argument false) or with the vectorized kernels (true).
+// The argument is the finest level of the mesh.
+template <bool kernels, std::size_t prediction_order, bool SOA>
+void BM_Prediction(benchmark::State& state)
+{
+    static constexpr std::size_t dim = 2;
+    using Config                     = samurai::MRConfig<dim, 2, 1, prediction_order>;
+    using Box                        = samurai::Box<double, dim>;
+    using mesh_id_t                  = typename samurai::MRMesh<Config>::mesh_id_t;
+
+    auto level = static_cast<std::size_t>(state.range(0));
+
+    Box box({-1., -1.}, {1., 1.});
+    samurai::MRMesh<Config> mesh{box, level - 4, level};
+
+    auto u = samurai::make_vector_field<double, 4, SOA>("u", mesh, 0.);
+    samurai::for_each_cell(mesh,
+                           [&](auto& cell)
+                           {
+                               for (std::size_t c = 0; c < 4; ++c)
+                               {
+                                   u[cell][c] = std::sin(cell.center(0) + static_cast<double>(c)) * std::cos(cell.center(1));
+                               }
+                           });
+    auto indicator = samurai::make_scalar_field<double>("indicator",
+                                                        mesh,
+                                                        [](const auto& x)
+                                                        {
+                                                            return x[0] * x[0] + x[1] * x[1] < 0.25 ? 1. : 0.;
+                                                        });
+    samurai::make_bc<samurai::Dirichlet<1>>(u, 0., 0., 0., 0.);
+    samurai::make_bc<samurai::Dirichlet<1>>(indicator, 0.);
+
+    auto MRadaptation = samurai::make_MRAdapt(indicator, u);
+    MRadaptation(1e-4, 1.);
+
+    auto detail = samurai::make_vector_field<double, 4, SOA>("detail", mesh, 0.);
+
+    samurai::args::disable_mr_kernels = !kernels;
+    for (auto _ : state)
+    {
+        samurai::update_ghost_mr(u);
+        for (std::size_t l = mesh.min_level() - 1; l < mesh.max_level(); ++l)
+        {
+            auto ghosts_below_cells = samurai::intersection(mesh[mesh_id_t::all_cells][l], mesh[mesh_id_t::cells][l + 1]).on(l);
+            ghosts_below_cells.apply_op(samurai::compute_detail(detail, u));
+        }
+        benchmark::DoNotOptimize(detail.array().data());
+    }
+    samurai::args::disable_mr_kernels = false;
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * mesh.nb_cells()));
+}
+
+BENCHMARK_TEMPLATE(BM_Prediction, false, 1, false)->DenseRange(8, 10, 2);
+BENCHMARK_TEMPLATE(BM_Prediction, true, 1, false)->DenseRange(8, 10, 2);
+BENCHMARK_TEMPLATE(BM_Prediction, false, 1, true)->DenseRange(8, 10, 2);
+BENCHMARK_TEMPLATE(BM_Prediction, true, 1, true)->DenseRange(8, 10, 2);
+BENCHMARK_TEMPLATE(BM_Prediction, false, 2, false)->DenseRange(8, 10, 2);
+BENCHMARK_TEMPLATE(BM_Prediction, true, 2, false)->DenseRange(8, 10, 2);
@@ -1,4 +1,5 @@
 #include <array>
+#include <vector>
 #include <benchmark/benchmark.h>
 #include <experimental/random>
 
@@ -51,7 +52,7 @@ auto generate_mesh(int bound, std::size_t start_level, std::size_t max_level)
     return ca;
 }
 
-template <std::size_t dim_, int bound>
+template <std::size_t dim_, int bound, samurai::FindMethod method = samurai::FindMethod::Binary>
 class MyFixture : public ::benchmark::Fixture
 {
   public:
@@ -73,12 +74,12 @@ class MyFixture : public ::benchmark::Fixture
             for (std::size_t s = 0; s < state.range(0); ++s)
             {
                 auto level = std::experimental::randint(min_level, max_level);
-                std::array<int, dim> coord;
+                xt::xtensor_fixed<int, xt::xshape<dim>> coord;
                 for (auto& c : coord)
                 {
                     c = std::experimental::randint(-bound << level, (bound << level) - 1);
                 }
-                auto out = samurai::find(mesh[level], coord);
+                auto out = samurai::find<method>(mesh[level], coord);
                 if (out != -1)
                 {
                     found++;
@@ -116,3 +117,66 @@ BENCHMARK_TEMPLATE_DEFINE_F(MyFixture, Search_3D, 3, 1)(benchmark::State& state)
 }
 
 BENCHMARK_REGISTER_F(MyFixture, Search_3D)->DenseRange(1, 10, 1);
+
+BENCHMARK_TEMPLATE_DEFINE_F(MyFixture, Search_3D_Linear, 3, 1, samurai::FindMethod::Linear)(benchmark::State& state)
+{
+    bench(state);
+}
+
+BENCHMARK_REGISTER_F(MyFixture, Search_3D_Linear)->DenseRange(1, 10, 1);
+
+/////////////////////////////////////////////////////////
+// Crossover between the search methods vs row length //
+/////////////////////////////////////////////////////////
+
+// One row made of `nb_intervals` intervals of length 2 separated by holes of length 1.
+template <std::size_t dim>
+auto generate_row(std::size_t nb_intervals)
+{
+    samurai::LevelCellArray<dim> lca(0);
+    xt::xtensor_fixed<int, xt::xshape<dim - 1>> yz;
+    yz.fill(0);
+    for (int k = 0; k < static_cast<int>(nb_intervals); ++k)
+    {
+        lca.add_interval_back({3 * k, 3 * k + 2}, yz);
+    }
+    return lca;
+}
+
+template <samurai::FindMethod method>
+static void BM_SearchRowLength(benchmark::State& state)
+{
+    constexpr std::size_t dim = 2;
+    constexpr int nb_search   = 1000;
+
+    auto nb_intervals = static_cast<std::size_t>(state.range(0));
+    auto lca          = generate_row<dim>(nb_intervals);
+
+    // range(1) == 0: random searches, range(1) == 1: sweep along the row (sliding stencil)
+    bool sweep = state.range(1) == 1;
+    std::vector<xt::xtensor_fixed<int, xt::xshape<dim>>> coords(nb_search);
+    for (std::size_t s = 0; s < coords.size(); ++s)
+    {
+        int x     = sweep ? static_cast<int>(s * 3 * nb_intervals / nb_search)
+                          : std::experimental::randint(0, 3 * static_cast<int>(nb_intervals) - 1);
+        coords[s] = {x, 0};
+    }
+
+    samurai::find_hint_t<dim> hint{};
+    std::size_t found = 0;
+    for (auto _ : state)
+    {
+        for (const auto& coord : coords)
+        {
+            if (samurai::find<method>(lca, coord, hint) != -1)
+            {
+                found++;
+            }
+        }
+    }
+    state.counters["found"] = static_cast<double>(found) / static_cast<double>(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_SearchRowLength, samurai::FindMethod::Linear)->ArgsProduct({benchmark::CreateRange(1, 1 << 12, 2), {0, 1}});
+BENCHMARK_TEMPLATE(BM_SearchRowLength, samurai::FindMethod::Binary)->ArgsProduct({benchmark::CreateRange(1, 1 << 12, 2), {0, 1}});
+BENCHMARK_TEMPLATE(BM_SearchRowLength, samurai::FindMethod::Galloping)->ArgsProduct({benchmark::CreateRange(1, 1 << 12, 2), {0, 1}});
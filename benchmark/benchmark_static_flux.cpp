@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <samurai/bc.hpp>
+#include <samurai/field.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/schemes/fv.hpp>
+
+// Explicit application of an upwind Burgers flux on a uniform 2D mesh,
+// the flux function being called through a std::function or inlined.
+// The argument is the level of the mesh.
+template <bool static_flux>
+void BM_NonLinearFluxDispatch(benchmark::State& state)
+{
+    static constexpr std::size_t dim = 2;
+    using Config                     = samurai::MRConfig<dim>;
+    using Box                        = samurai::Box<double, dim>;
+
+    auto level = static_cast<std::size_t>(state.range(0));
+
+    Box box({-1., -1.}, {1., 1.});
+    samurai::MRMesh<Config> mesh{box, level, level};
+
+    auto u = samurai::make_vector_field<dim>("u", mesh);
+    samurai::for_each_cell(mesh,
+                           [&](auto& cell)
+                           {
+                               u[cell][0] = cell.center(0) * cell.center(0) < 0.25 ? 1. : 0.;
+                               u[cell][1] = cell.center(1) * cell.center(1) < 0.25 ? 1. : 0.;
+                           });
+    samurai::make_bc<samurai::Dirichlet<1>>(u, 0., 0.);
+
+    using cfg = samurai::FluxConfig<samurai::SchemeType::NonLinear, dim, 2, decltype(u)>;
+
+    auto burgers_flux = [](std::size_t d,
+                           samurai::FluxValue<cfg>& flux,
+                           const samurai::StencilData<cfg>& /* data */,
+                           const samurai::StencilValues<cfg>& v)
+    {
+        if (v[0](d) >= 0)
+        {
+            flux = v[0](d) * v[0];
+        }
+        else
+        {
+            flux = v[1](d) * v[1];
+        }
+    };
+
+    auto apply = [&](auto& scheme)
+    {
+        for (auto _ : state)
+        {
+            auto flux = scheme(u);
+            benchmark::DoNotOptimize(flux);
+        }
+    };
+
+    if constexpr (static_flux)
+    {
+        auto scheme = samurai::make_flux_based_scheme<cfg>(burgers_flux);
+        apply(scheme);
+    }
+    else
+    {
+        samurai::FluxDefinition<cfg> flux_definition;
+        for (std::size_t d = 0; d < dim; ++d)
+        {
+            flux_definition[d].cons_flux_function = [burgers_flux, d](auto& flux, const auto& data, const auto& v)
+            {
+                burgers_flux(d, flux, data, v);
+            };
+        }
+        auto scheme = samurai::make_flux_based_scheme(flux_definition);
+        apply(scheme);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * mesh.nb_cells(decltype(mesh)::mesh_id_t::cells)));
+}
+
+BENCHMARK_TEMPLATE(BM_NonLinearFluxDispatch, false)->DenseRange(6, 10, 2);
+BENCHMARK_TEMPLATE(BM_NonLinearFluxDispatch, true)->DenseRange(6, 10, 2);
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <samurai/arguments.hpp>
+#include <samurai/bc.hpp>
+#include <samurai/field.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/schemes/fv.hpp>
+
+// Explicit application of the non-linear WENO5 Burgers flux on a uniform 3D mesh, the interfaces being
+// traversed in the (z, y, x) order (tiled = false) or by tiles of y-rows (tiled = true).
+// The argument is the level of the mesh. The cache misses are reported with the perf counters of
+// Google Benchmark (when built with libpfm):
+//     bench_samurai --benchmark_filter=BM_TiledStencil --benchmark_perf_counters=CACHE-MISSES,L1-DCACHE-LOAD-MISSES
+template <bool tiled>
+void BM_TiledStencil(benchmark::State& state)
+{
+    static constexpr std::size_t dim = 3;
+    using Config                     = samurai::MRConfig<dim, 3>;
+    using Box                        = samurai::Box<double, dim>;
+
+    auto level = static_cast<std::size_t>(state.range(0));
+
+    auto tile_bytes                   = samurai::args::stencil_tile_bytes;
+    samurai::args::stencil_tile_bytes = tiled ? tile_bytes : 0;
+
+    Box box({-1., -1., -1.}, {1., 1., 1.});
+    samurai::MRMesh<Config> mesh{box, level, level};
+
+    auto u = samurai::make_vector_field<dim>("u", mesh);
+    samurai::for_each_cell(mesh,
+                           [&](auto& cell)
+                           {
+                               for (std::size_t d = 0; d < dim; ++d)
+                               {
+                                   u[cell][d] = cell.center(d) * cell.center(d) < 0.25 ? 1. : 0.;
+                               }
+                           });
+    samurai::make_bc<samurai::Dirichlet<3>>(u, 0., 0., 0.);
+
+    auto conv = samurai::make_convection_weno5<decltype(u)>();
+
+    for (auto _ : state)
+    {
+        auto flux = conv(u);
+        benchmark::DoNotOptimize(flux);
+    }
+    samurai::args::stencil_tile_bytes = tile_bytes;
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * mesh.nb_cells(decltype(mesh)::mesh_id_t::cells)));
+}
+
+BENCHMARK_TEMPLATE(BM_TiledStencil, false)->DenseRange(6, 7, 1);
+BENCHMARK_TEMPLATE(BM_TiledStencil, true)->DenseRange(6, 7, 1);
@@ -9,6 +9,7 @@
 #include <samurai/samurai.hpp>
 
 #include <filesystem>
+#include <optional>
 namespace fs = std::filesystem;
 
 template <std::size_t dim>
@@ -210,6 +211,15 @@ int main(int argc, char* argv[])
         save(path, filename, u, fmt::format("_ite_{}", nsave++));
     }
 
+    // Implicit scheme: the solver keeps its matrix and its setup while the mesh and dt are unchanged
+    const double back_euler_dt = dt;
+    auto back_euler            = id + back_euler_dt * diff;
+    std::optional<decltype(samurai::petsc::make_solver(back_euler))> solver;
+    if (!explicit_scheme)
+    {
+        solver.emplace(back_euler);
+    }
+
     double t = t0;
     while (t != Tf)
     {
@@ -233,8 +243,15 @@ int main(int argc, char* argv[])
         }
         else
         {
-            auto back_euler = id + dt * diff;
-            samurai::petsc::solve(back_euler, unp1, u); // solves the linear equation   [Id + dt*Diff](unp1) = u
+            if (dt == back_euler_dt)
+            {
+                solver->solve(unp1, u); // solves the linear equation   [Id + dt*Diff](unp1) = u
+            }
+            else // last time step, shortened to reach Tf
+            {
+                auto last_back_euler = id + dt * diff;
+                samurai::petsc::solve(last_back_euler, unp1, u);
+            }
         }
 
         // u <-- unp1
@@ -253,7 +253,8 @@ int main(int argc, char* argv[])
             unp1 = u;
             // Solve the non-linear equation   [Id - dt*React](unp1) = u - dt*Diff(u)
             // Here, small independent local Newton methods are used.
-            samurai::petsc::solve(implicit_operator, unp1, rhs);
+            auto local_solvers = samurai::make_local_newton_solvers(implicit_operator);
+            local_solvers.solve(unp1, rhs);
         }
         else
         {
@@ -6,6 +6,8 @@
 #ifdef SAMURAI_WITH_OPENMP
 #include <omp.h>
 #endif
+#include <algorithm>
+#include <array>
 #include <type_traits>
 
 #include <xtensor/xfixed.hpp>
@@ -13,6 +15,7 @@
 
 #include "cell.hpp"
 #include "mesh_holder.hpp"
+#include "subset/parallel_apply.hpp"
 
 using namespace xt::placeholders;
 
@@ -42,6 +45,27 @@ namespace samurai
         Intervals
     };
 
+    /**
+     * Algorithm used to look for an interval in a row of a LevelCellArray.
+     *
+     * - Linear: scan of the row, the fastest for rows of a few intervals.
+     * - Binary: branchless binary search on the sorted interval starts.
+     * - Galloping: exponential search starting from the position of the
+     *   previous hit (see find_hint_t), then binary search. It is the method
+     *   of choice when consecutive searches are close to each other, e.g.
+     *   when a stencil slides along the mesh.
+     */
+    enum class FindMethod
+    {
+        Linear,
+        Binary,
+        Galloping
+    };
+
+    /// Position of the last interval found in each dimension, used as a starting point by FindMethod::Galloping.
+    template <std::size_t dim>
+    using find_hint_t = std::array<std::size_t, dim>;
+
     ///////////////////////////////////
     // for_each_level implementation //
     ///////////////////////////////////
@@ -174,19 +198,14 @@ namespace samurai
     template <class MeshIntervalType, class SetType, class Func>
     inline void parallel_for_each_meshinterval(SetType& set, Func&& f)
     {
-#pragma omp parallel
-#pragma omp single nowait
-        set(
-            [&](const auto& i, const auto& index)
-            {
-#pragma omp task
-                {
-                    MeshIntervalType mesh_interval(set.level());
-                    mesh_interval.i     = i;
-                    mesh_interval.index = index;
-                    f(mesh_interval);
-                }
-            });
+        parallel_apply(set,
+                       [&](const auto& i, const auto& index)
+                       {
+                           MeshIntervalType mesh_interval(set.level());
+                           mesh_interval.i     = i;
+                           mesh_interval.index = index;
+                           f(mesh_interval);
+                       });
     }
 
     template <class MeshIntervalType, Run run_type, class SetType, class Func>
@@ -367,26 +386,6 @@ namespace samurai
 
     namespace detail
     {
-        // template <class ForwardIt, class T>
-        // auto interval_search(ForwardIt first, ForwardIt last, const T& value)
-        // {
-        //     auto comp = [](const auto& interval, auto v)
-        //     {
-        //         return interval.end < v;
-        //     };
-
-        //     auto result = std::lower_bound(first, last, value, comp);
-
-        //     if (!(result == last) && !(comp(*result, value)))
-        //     {
-        //         if (result->contains(value))
-        //         {
-        //             return static_cast<int>(std::distance(first, result));
-        //         }
-        //     }
-        //     return -1;
-        // }
-
         template <class ForwardIt, class T>
         inline auto interval_search(ForwardIt first, ForwardIt last, const T& value)
         {
@@ -400,35 +399,119 @@ namespace samurai
             return -1;
         }
 
-        // template <class ForwardIt, class T>
-        // inline auto interval_search(ForwardIt first, ForwardIt last, const T& value)
-        // {
-        //     auto it = std::find_if(first,
-        //                            last,
-        //                            [value](const auto& e)
-        //                            {
-        //                                return e.contains(value);
-        //                            });
-        //     return (it == last) ? -1 : static_cast<int>(std::distance(first, it));
-        // }
-
-        template <std::size_t dim, class TInterval, class index_t = typename TInterval::index_t, class coord_index_t = typename TInterval::coord_index_t>
+        /**
+         * Branchless binary search: the intervals of a row are sorted and
+         * disjoint, so we look for the last interval whose start is lower or
+         * equal to the value and check if it contains it.
+         */
+        template <class RandomIt, class T>
+        inline auto interval_search_binary(RandomIt first, RandomIt last, const T& value)
+        {
+            auto n = std::distance(first, last);
+            if (n == 0)
+            {
+                return -1;
+            }
+            auto base = first;
+            while (n > 1)
+            {
+                auto half = n / 2;
+                base      = (base[half].start <= value) ? base + half : base;
+                n -= half;
+            }
+            return base->contains(value) ? static_cast<int>(std::distance(first, base)) : -1;
+        }
+
+        /**
+         * Exponential search around the position @p hint (relative to @p first),
+         * followed by a binary search in the bracketing range.
+         */
+        template <class RandomIt, class T>
+        inline auto interval_search_galloping(RandomIt first, RandomIt last, const T& value, std::ptrdiff_t hint)
+        {
+            using diff_t = typename std::iterator_traits<RandomIt>::difference_type;
+
+            auto n = static_cast<diff_t>(std::distance(first, last));
+            if (n == 0)
+            {
+                return -1;
+            }
+            diff_t lo   = 0;
+            diff_t hi   = n;
+            diff_t step = 1;
+            diff_t pos  = std::clamp(static_cast<diff_t>(hint), diff_t{0}, n - 1);
+            if (first[pos].start <= value)
+            {
+                // first[lo].start <= value
+                lo = pos;
+                while (lo + step < n && first[lo + step].start <= value)
+                {
+                    lo += step;
+                    step *= 2;
+                }
+                hi = std::min(lo + step, n);
+            }
+            else
+            {
+                // first[hi].start > value
+                hi = pos;
+                while (hi - step > 0 && first[hi - step].start > value)
+                {
+                    hi -= step;
+                    step *= 2;
+                }
+                lo = std::max(hi - step, diff_t{0});
+            }
+            auto find_index = interval_search_binary(first + lo, first + hi, value);
+            return (find_index != -1) ? find_index + static_cast<int>(lo) : find_index;
+        }
+
+        template <FindMethod method, class RandomIt, class T>
+        inline auto interval_search(RandomIt first, RandomIt last, const T& value, [[maybe_unused]] std::ptrdiff_t hint)
+        {
+            if constexpr (method == FindMethod::Linear)
+            {
+                return interval_search(first, last, value);
+            }
+            else if constexpr (method == FindMethod::Binary)
+            {
+                return interval_search_binary(first, last, value);
+            }
+            else
+            {
+                return interval_search_galloping(first, last, value, hint);
+            }
+        }
+
+        template <FindMethod method,
+                  std::size_t dim,
+                  class TInterval,
+                  class index_t       = typename TInterval::index_t,
+                  class coord_index_t = typename TInterval::coord_index_t>
         inline auto find_impl(const LevelCellArray<dim, TInterval>& lca,
                               std::size_t start_index,
                               std::size_t end_index,
                               const xt::xtensor_fixed<coord_index_t, xt::xshape<dim>>& coord,
+                              find_hint_t<dim>& hint,
                               std::integral_constant<std::size_t, 0>) -> index_t
         {
             using lca_t     = const LevelCellArray<dim, TInterval>;
             using diff_t    = typename lca_t::const_iterator::difference_type;
-            auto find_index = interval_search(lca[0].cbegin() + static_cast<diff_t>(start_index),
-                                              lca[0].cbegin() + static_cast<diff_t>(end_index),
-                                              coord[0]);
+            auto find_index = interval_search<method>(lca[0].cbegin() + static_cast<diff_t>(start_index),
+                                                      lca[0].cbegin() + static_cast<diff_t>(end_index),
+                                                      coord[0],
+                                                      static_cast<std::ptrdiff_t>(hint[0]) - static_cast<std::ptrdiff_t>(start_index));
 
-            return (find_index != -1) ? find_index + static_cast<diff_t>(start_index) : find_index;
+            if (find_index != -1)
+            {
+                hint[0] = static_cast<std::size_t>(find_index) + start_index;
+                return find_index + static_cast<diff_t>(start_index);
+            }
+            return find_index;
         }
 
-        template <std::size_t dim,
+        template <FindMethod method,
+                  std::size_t dim,
                   class TInterval,
                   class index_t       = typename TInterval::index_t,
                   class coord_index_t = typename TInterval::coord_index_t,
@@ -437,31 +520,63 @@ namespace samurai
                               std::size_t start_index,
                               std::size_t end_index,
                               const xt::xtensor_fixed<coord_index_t, xt::xshape<dim>>& coord,
+                              find_hint_t<dim>& hint,
                               std::integral_constant<std::size_t, N>) -> index_t
         {
             using lca_t        = const LevelCellArray<dim, TInterval>;
             using diff_t       = typename lca_t::const_iterator::difference_type;
-            index_t find_index = interval_search(lca[N].cbegin() + static_cast<diff_t>(start_index),
-                                                 lca[N].cbegin() + static_cast<diff_t>(end_index),
-                                                 coord[N]);
+            index_t find_index = interval_search<method>(lca[N].cbegin() + static_cast<diff_t>(start_index),
+                                                         lca[N].cbegin() + static_cast<diff_t>(end_index),
+                                                         coord[N],
+                                                         static_cast<std::ptrdiff_t>(hint[N]) - static_cast<std::ptrdiff_t>(start_index));
 
             if (find_index != -1)
             {
-                auto off_ind = static_cast<std::size_t>(lca[N][static_cast<std::size_t>(find_index) + start_index].index + coord[N]);
-                find_index   = find_impl(lca,
-                                       lca.offsets(N)[off_ind],
-                                       lca.offsets(N)[off_ind + 1],
-                                       coord,
-                                       std::integral_constant<std::size_t, N - 1>{});
+                hint[N]      = static_cast<std::size_t>(find_index) + start_index;
+                auto off_ind = static_cast<std::size_t>(lca[N][hint[N]].index + coord[N]);
+                find_index   = find_impl<method>(lca,
+                                               lca.offsets(N)[off_ind],
+                                               lca.offsets(N)[off_ind + 1],
+                                               coord,
+                                               hint,
+                                               std::integral_constant<std::size_t, N - 1>{});
             }
             return find_index;
         }
     } // namespace detail
 
-    template <std::size_t dim, class TInterval, class index_t = typename TInterval::index_t, class coord_index_t = typename TInterval::coord_index_t>
+    /**
+     * Return the position in lca[0] of the x-interval containing the given
+     * coordinates, -1 if there is none.
+     *
+     * @tparam method The search algorithm used in each row.
+     */
+    template <FindMethod method = FindMethod::Binary,
+              std::size_t dim,
+              class TInterval,
+              class index_t       = typename TInterval::index_t,
+              class coord_index_t = typename TInterval::coord_index_t>
     inline auto find(const LevelCellArray<dim, TInterval>& lca, const xt::xtensor_fixed<coord_index_t, xt::xshape<dim>>& coord) -> index_t
     {
-        return detail::find_impl(lca, 0, lca[dim - 1].size(), coord, std::integral_constant<std::size_t, dim - 1>{});
+        find_hint_t<dim> hint{};
+        return detail::find_impl<method>(lca, 0, lca[dim - 1].size(), coord, hint, std::integral_constant<std::size_t, dim - 1>{});
+    }
+
+    /**
+     * Same as above, but the search starts from the positions stored in @p hint,
+     * which are updated with the positions found. The hint can be reused for
+     * any LevelCellArray.
+     */
+    template <FindMethod method = FindMethod::Galloping,
+              std::size_t dim,
+              class TInterval,
+              class index_t       = typename TInterval::index_t,
+              class coord_index_t = typename TInterval::coord_index_t>
+    inline auto find(const LevelCellArray<dim, TInterval>& lca,
+                     const xt::xtensor_fixed<coord_index_t, xt::xshape<dim>>& coord,
+                     find_hint_t<dim>& hint) -> index_t
+    {
+        return detail::find_impl<method>(lca, 0, lca[dim - 1].size(), coord, hint, std::integral_constant<std::size_t, dim - 1>{});
     }
 
     template <std::size_t dim, class TInterval, class coord_index_t = typename TInterval::coord_index_t, class index_t = typename TInterval::index_t>
@@ -470,9 +585,9 @@ namespace samurai
     {
         using lca_t        = const LevelCellArray<dim, TInterval>;
         using diff_t       = typename lca_t::const_iterator::difference_type;
-        index_t find_index = detail::interval_search(lca[d].cbegin() + static_cast<diff_t>(start_index),
-                                                     lca[d].cbegin() + static_cast<diff_t>(end_index),
-                                                     coord);
+        index_t find_index = detail::interval_search_binary(lca[d].cbegin() + static_cast<diff_t>(start_index),
+                                                            lca[d].cbegin() + static_cast<diff_t>(end_index),
+                                                            coord);
 
         return (find_index != -1) ? static_cast<std::size_t>(find_index) + start_index : std::numeric_limits<std::size_t>::max();
     }
@@ -290,13 +290,20 @@ namespace samurai
                 }
             };
 
-            for (size_t fine_level = max_level; fine_level > min_fine_level; --fine_level)
+            // The list of a coarse level is filled by a single thread, in the order of the fine levels
+            // (from the finest one): it does not depend on the number of threads.
+            // Note: with min_level = 0, no coarse level is listed.
+            const size_t n_coarse_levels = (min_level > 0 && max_level > min_fine_level) ? max_level - min_fine_level : 0;
+#pragma omp parallel for schedule(dynamic)
+            for (std::ptrdiff_t n = 0; n < static_cast<std::ptrdiff_t>(n_coarse_levels); ++n)
             {
-                const int delta_l = int(domain.level() - fine_level);
-                auto directions   = detail::get_periodic_directions(nb_cells_finest_level, delta_l, is_periodic);
-                auto& fine_lca    = lhs_ca[fine_level];
-                for (size_t coarse_level = fine_level - 2; coarse_level > min_level - 1; --coarse_level)
+                const size_t coarse_level = min_level + static_cast<size_t>(n);
+                for (size_t fine_level = max_level; fine_level >= coarse_level + 2; --fine_level)
                 {
+                    const int delta_l = int(domain.level() - fine_level);
+                    auto directions   = detail::get_periodic_directions(nb_cells_finest_level, delta_l, is_periodic);
+                    auto& fine_lca    = lhs_ca[fine_level];
+
                     bool isIntersectionEmpty = true;
                     switch (directions.size())
                     {
@@ -532,10 +539,6 @@ namespace samurai
             }
         }
 
-        std::vector<TInterval> add_p_interval;
-        std::vector<coord_type> add_p_inner_stencil;
-        std::vector<size_t> add_p_idx;
-
         std::array<ArrayOfIntervalAndPoint<TInterval, coord_type>, max_size> remove_m_all;
 
         ca_type ca_add_p;
@@ -557,11 +560,17 @@ namespace samurai
             ca_remove_p.clear();
             list_intervals_to_refine(grad_width, half_stencil_width, ca, domain, mpi_neighbourhood, is_periodic, nb_cells_finest_level, remove_m_all);
 
-            add_p_interval.clear();
-            add_p_inner_stencil.clear();
-            add_p_idx.clear();
-            for (size_t level = min_level; level != max_level + 1; ++level)
+            // The levels are independent: the level L only writes in ca_remove_p[L] and ca_add_p[L + 1].
+            const auto n_levels = static_cast<std::ptrdiff_t>(max_level + 1 - min_level);
+#pragma omp parallel for schedule(dynamic)
+            for (std::ptrdiff_t n = 0; n < n_levels; ++n)
             {
+                const size_t level = min_level + static_cast<size_t>(n);
+
+                std::vector<TInterval> add_p_interval;
+                std::vector<coord_type> add_p_inner_stencil;
+                std::vector<size_t> add_p_idx;
+
                 remove_m_all[level].remove_overlapping_intervals();
                 const size_t imax = remove_m_all[level].size();
                 for (size_t i = 0; i != imax; ++i)
@@ -599,8 +608,11 @@ namespace samurai
             } // end for level
             // We then create new_ca as ca U ca_add
             new_ca.clear();
-            for (std::size_t level = min_level; level != max_level + 1; ++level)
+#pragma omp parallel for schedule(dynamic)
+            for (std::ptrdiff_t n = 0; n < n_levels; ++n)
             {
+                const size_t level = min_level + static_cast<size_t>(n);
+
                 auto set = difference(union_(ca[level], ca_add_p[level]), ca_remove_p[level]);
                 set(
                     [&](const auto& x_interval, const auto& yz)
@@ -630,6 +642,25 @@ namespace samurai
         return make_graduation(ca, domain, mpi_neighbourhood, is_periodic, grad_width);
     }
 
+    namespace detail
+    {
+        /**
+         * Consecutive intervals of a level of the mesh, with the cells that their tags add to or remove from the mesh
+         * (see update_cell_array_from_tag).
+         */
+        template <class LevelCellArray>
+        struct tag_update_chunk
+        {
+            std::size_t level;
+            std::size_t begin;
+            std::size_t end;
+            LevelCellArray add_m;    // cells added at level - 1
+            LevelCellArray remove_m; // cells removed at level
+            LevelCellArray add_p;    // cells added at level + 1
+            LevelCellArray remove_p; // cells removed at level
+        };
+    }
+
     template <std::size_t dim, class TInterval, size_t max_size, class Tag>
     CellArray<dim, TInterval, max_size> update_cell_array_from_tag(const CellArray<dim, TInterval, max_size>& old_ca, const Tag& tag)
     {
@@ -637,31 +668,65 @@ namespace samurai
         using value_t          = typename TInterval::value_t;
         using unsigned_value_t = typename std::make_unsigned_t<value_t>;
         using ca_type          = CellArray<dim, TInterval, max_size>;
-        using coord_type       = typename ca_type::lca_type::coord_type;
+        using lca_type         = typename ca_type::lca_type;
+        using coord_type       = typename lca_type::coord_type;
+        using chunk_t          = detail::tag_update_chunk<lca_type>;
+
+        // minimal number of intervals of a chunk
+        static constexpr std::size_t chunk_size = 256;
 
         const auto& mesh = tag.mesh();
 
         const size_t start_level = old_ca.min_level();
         const size_t end_level   = old_ca.max_level() + 1;
 
+        // The intervals of each level are split into chunks, which are processed by the threads with their own cell arrays.
+        // A chunk holds whole planes of the outermost direction, since the refined cells are added plane by plane
+        // (see add_list_of_interval_back): the cell arrays of the chunks of a level can then be appended one after the other.
+        std::vector<std::vector<std::pair<TInterval, coord_type>>> intervals(end_level);
+        std::vector<chunk_t> chunks;
+        for (size_t level = start_level; level != end_level; ++level)
+        {
+            auto& level_intervals = intervals[level];
+            for_each_interval(old_ca[level],
+                              [&](std::size_t, const auto& x_interval, const auto& yz)
+                              {
+                                  level_intervals.emplace_back(x_interval, yz);
+                              });
+
+            std::size_t begin = 0;
+            for (std::size_t k = 0; k < level_intervals.size(); ++k)
+            {
+                bool plane_end = k + 1 == level_intervals.size();
+                if constexpr (dim > 1)
+                {
+                    plane_end = plane_end || level_intervals[k + 1].second[dim - 2] != level_intervals[k].second[dim - 2];
+                }
+                if (plane_end && (k + 1 - begin >= chunk_size || k + 1 == level_intervals.size()))
+                {
+                    chunks.push_back({level, begin, k + 1, {}, {}, {}, {}});
+                    begin = k + 1;
+                }
+            }
+        }
+
         // create the ensemble of cells to coarsen
-        ca_type ca_add_m;
-        ca_type ca_remove_m;
-        ca_type ca_add_p;
-        ca_type ca_remove_p;
+        const auto n_chunks = static_cast<std::ptrdiff_t>(chunks.size());
+#pragma omp parallel for schedule(dynamic)
+        for (std::ptrdiff_t c = 0; c < n_chunks; ++c)
+        {
+            auto& chunk                 = chunks[static_cast<std::size_t>(c)];
+            const size_t level          = chunk.level;
+            const auto& level_intervals = intervals[level];
 
-        std::vector<TInterval> add_p_interval;
-        std::vector<coord_type> add_p_inner_stencil;
-        std::vector<size_t> add_p_idx;
+            std::vector<TInterval> add_p_interval;
+            std::vector<coord_type> add_p_inner_stencil;
+            std::vector<size_t> add_p_idx;
 
-        for (size_t level = start_level; level != end_level; ++level)
-        {
-            const auto begin = old_ca[level].cbegin();
-            const auto end   = old_ca[level].cend();
-            for (auto it = begin; it != end; ++it)
+            for (std::size_t k = chunk.begin; k != chunk.end; ++k)
             {
-                const auto& x_interval = *it;
-                const auto& yz         = it.index();
+                const auto& x_interval = level_intervals[k].first;
+                const auto& yz         = level_intervals[k].second;
                 const bool is_yz_even  = dim == 1 or xt::all(xt::equal(yz % 2, 0));
 
                 for (value_t x = x_interval.start; x < x_interval.end; ++x)
@@ -672,10 +737,10 @@ namespace samurai
                                                and not(tag[itag] & static_cast<int>(CellFlag::keep));
                     if (refine and level < mesh.max_level())
                     {
-                        ca_remove_p[level].add_point_back(x, yz);
+                        chunk.remove_p.add_point_back(x, yz);
                         if constexpr (dim == 1)
                         {
-                            ca_add_p[level + 1].add_interval_back({2 * x, 2 * x + 2}, {});
+                            chunk.add_p.add_interval_back({2 * x, 2 * x + 2}, {});
                         }
                         else
                         {
@@ -697,23 +762,63 @@ namespace samurai
                     {
                         if (x % 2 == 0 and is_yz_even) // should be modified when using load balancing.
                         {
-                            ca_add_m[level - 1].add_point_back(x >> 1, yz >> 1);
+                            chunk.add_m.add_point_back(x >> 1, yz >> 1);
                         }
-                        ca_remove_m[level].add_point_back(x, yz);
+                        chunk.remove_m.add_point_back(x, yz);
                     }
                 } // end for each x
-                if (dim != 1 and (it + 1 == end or (it + 1).index()[dim - 2] != yz[dim - 2]))
+                if (dim != 1 and (k + 1 == chunk.end or level_intervals[k + 1].second[dim - 2] != yz[dim - 2]))
                 {
-                    add_list_of_interval_back(add_p_interval, coord_type(2 * yz), add_p_inner_stencil, add_p_idx, ca_add_p[level + 1]);
+                    add_list_of_interval_back(add_p_interval, coord_type(2 * yz), add_p_inner_stencil, add_p_idx, chunk.add_p);
                     add_p_interval.clear();
                     add_p_inner_stencil.clear();
                     add_p_idx.clear();
                 }
             } // end for each interval
-        } // end for each level
+        } // end for each chunk
+
+        // The cells of the chunks of a level go to the levels level - 1, level and level + 1 in the order of the chunks.
+        ca_type ca_add_m;
+        ca_type ca_remove_m;
+        ca_type ca_add_p;
+        ca_type ca_remove_p;
+
+        const auto append = [](lca_type& lca, const lca_type& chunk_lca)
+        {
+            for_each_interval(chunk_lca,
+                              [&](std::size_t, const auto& x_interval, const auto& yz)
+                              {
+                                  lca.add_interval_back(x_interval, yz);
+                              });
+        };
+
+        const auto n_old_levels = static_cast<std::ptrdiff_t>(end_level - start_level);
+#pragma omp parallel for schedule(dynamic)
+        for (std::ptrdiff_t n = 0; n < n_old_levels; ++n)
+        {
+            const size_t level = start_level + static_cast<size_t>(n);
+            for (const auto& chunk : chunks)
+            {
+                if (chunk.level == level)
+                {
+                    if (level > 0)
+                    {
+                        append(ca_add_m[level - 1], chunk.add_m);
+                    }
+                    append(ca_remove_m[level], chunk.remove_m);
+                    append(ca_add_p[level + 1], chunk.add_p);
+                    append(ca_remove_p[level], chunk.remove_p);
+                }
+            }
+        }
+
         CellArray<dim, TInterval, max_size> new_ca;
-        for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+        const auto n_new_levels = static_cast<std::ptrdiff_t>(mesh.max_level() + 1 - mesh.min_level());
+#pragma omp parallel for schedule(dynamic)
+        for (std::ptrdiff_t n = 0; n < n_new_levels; ++n)
         {
+            const std::size_t level = mesh.min_level() + static_cast<std::size_t>(n);
+
             auto set = difference(union_(old_ca[level], ca_add_m[level], ca_add_p[level]), union_(ca_remove_m[level], ca_remove_p[level]));
             set(
                 [&](const auto& x_interval, const auto& yz)
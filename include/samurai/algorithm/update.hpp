@@ -4,6 +4,7 @@
 #pragma once
 
 #include <algorithm>
+#include <stdexcept>
 
 #include <xtensor/xfixed.hpp>
 
@@ -13,6 +14,7 @@
 #include "../numeric/prediction.hpp"
 #include "../numeric/projection.hpp"
 #include "../subset/node.hpp"
+#include "../subset_cache.hpp"
 #include "../timers.hpp"
 #include "graduation.hpp"
 #include "utils.hpp"
@@ -39,7 +41,14 @@ namespace samurai
         update_outer_ghosts(max_level, field, fields...);
         for (std::size_t level = max_level; level >= 1; --level)
         {
-            auto set_at_levelm1 = intersection(mesh[mesh_id_t::proj_cells][level], mesh[mesh_id_t::reference][level - 1]).on(level - 1);
+            auto& set_at_levelm1 = cached_subset(mesh,
+                                                 {"update_ghost.projection", level - 1},
+                                                 [&]()
+                                                 {
+                                                     return intersection(mesh[mesh_id_t::proj_cells][level],
+                                                                         mesh[mesh_id_t::reference][level - 1])
+                                                         .on(level - 1);
+                                                 });
             set_at_levelm1.apply_op(variadic_projection(field, fields...));
             update_outer_ghosts(level - 1, field, fields...);
         }
@@ -47,7 +56,14 @@ namespace samurai
         update_outer_ghosts(0, field, fields...);
         for (std::size_t level = mesh[mesh_id_t::reference].min_level(); level <= max_level; ++level)
         {
-            auto set_at_level = intersection(mesh[mesh_id_t::pred_cells][level], mesh[mesh_id_t::reference][level - 1]).on(level);
+            auto& set_at_level = cached_subset(mesh,
+                                               {"update_ghost.prediction", level},
+                                               [&]()
+                                               {
+                                                   return intersection(mesh[mesh_id_t::pred_cells][level],
+                                                                       mesh[mesh_id_t::reference][level - 1])
+                                                       .on(level);
+                                               });
             set_at_level.apply_op(variadic_prediction<pred_order, false>(field, fields...));
         }
     }
@@ -101,14 +117,20 @@ namespace samurai
 
         assert(layer > 0 && layer <= Field::mesh_t::config::max_stencil_width);
 
-        auto& mesh  = field.mesh();
-        auto domain = self(mesh.domain()).on(proj_level);
+        auto& mesh = field.mesh();
 
-        auto& inner = mesh.get_union()[proj_level];
-        // We want only 1 layer (the further one),
-        // so we remove all closer layers by making the difference with the domain translated by (layer - 1) * direction
-        auto outside_layer     = difference(translate(inner, layer * direction), translate(domain, (layer - 1) * direction));
-        auto projection_ghosts = intersection(outside_layer, mesh[mesh_id_t::reference][proj_level]).on(proj_level);
+        auto make_projection_ghosts = [&]()
+        {
+            auto domain = self(mesh.domain()).on(proj_level);
+            auto& inner = mesh.get_union()[proj_level];
+            // We want only 1 layer (the further one),
+            // so we remove all closer layers by making the difference with the domain translated by (layer - 1) * direction
+            auto outside_layer = difference(translate(inner, layer * direction), translate(domain, (layer - 1) * direction));
+            return intersection(outside_layer, mesh[mesh_id_t::reference][proj_level]).on(proj_level);
+        };
+        std::vector<int> params(direction.begin(), direction.end());
+        params.push_back(layer);
+        auto& projection_ghosts = cached_subset(mesh, {"project_bc", proj_level, std::move(params)}, make_projection_ghosts);
 
         lca_t proj_ghost_lca(proj_level, mesh.origin_point(), mesh.scaling_factor());
 
@@ -228,9 +250,15 @@ namespace samurai
 
         auto& mesh = field.mesh();
 
-        auto& cells                    = mesh[mesh_id_t::cells][pred_level - 1];
-        auto bc_ghosts                 = difference(translate(cells, direction), self(mesh.domain()).on(pred_level - 1));
-        auto outside_prediction_ghosts = intersection(bc_ghosts, mesh[mesh_id_t::reference][pred_level]).on(pred_level);
+        auto& outside_prediction_ghosts = cached_subset(
+            mesh,
+            {"predict_bc", pred_level, std::vector<int>(direction.begin(), direction.end())},
+            [&]()
+            {
+                auto& cells    = mesh[mesh_id_t::cells][pred_level - 1];
+                auto bc_ghosts = difference(translate(cells, direction), self(mesh.domain()).on(pred_level - 1));
+                return intersection(bc_ghosts, mesh[mesh_id_t::reference][pred_level]).on(pred_level);
+            });
 
         outside_prediction_ghosts(
             [&](const auto& i, const auto& index)
@@ -390,8 +418,29 @@ namespace samurai
         update_outer_ghosts(level, fields...);
     }
 
+#ifdef SAMURAI_WITH_MPI
+    namespace detail
+    {
+        template <class Field, class... Fields>
+        void post_halo_exchange(std::size_t min_level, std::size_t max_level, bool with_corners, Field& field, Fields&... other_fields);
+
+        template <class Op, class Field, class... Fields>
+        void complete_halo_exchange(const Op& op, Field& field, Fields&... other_fields);
+    }
+#endif
+
+    /**
+     * First half of the split-phase ghost update (see update_ghost_mr).
+     * All the ghosts are updated, except the ghosts of the finest level coming from
+     * the neighbouring subdomains: nothing else depends on them, so that their
+     * exchange is only posted. Until finish_ghost_update(fields) is called, the values
+     * which do not depend on those ghosts can be computed, e.g. by the apply_interior
+     * function of the explicit schemes.
+     * A mesh holds one exchange in flight: exchanging ghosts of fields of the same mesh
+     * before finish_ghost_update throws std::logic_error.
+     */
     template <class Field, class... Fields>
-    void update_ghost_mr(Field& field, Fields&... other_fields)
+    void start_ghost_update(Field& field, Fields&... other_fields)
     {
         using mesh_id_t                  = typename Field::mesh_t::mesh_id_t;
         constexpr std::size_t pred_order = Field::mesh_t::config::prediction_order;
@@ -409,7 +458,14 @@ namespace samurai
             update_ghost_periodic(level, field, other_fields...);
             update_ghost_subdomains(level, field, other_fields...);
 
-            auto set_at_levelm1 = intersection(mesh[mesh_id_t::reference][level], mesh[mesh_id_t::proj_cells][level - 1]).on(level - 1);
+            auto& set_at_levelm1 = cached_subset(mesh,
+                                                 {"update_ghost_mr.projection", level - 1},
+                                                 [&]()
+                                                 {
+                                                     return intersection(mesh[mesh_id_t::reference][level],
+                                                                         mesh[mesh_id_t::proj_cells][level - 1])
+                                                         .on(level - 1);
+                                                 });
             set_at_levelm1.apply_op(variadic_projection(field, other_fields...));
 
             update_outer_ghosts(level - 1, field, other_fields...);
@@ -422,23 +478,66 @@ namespace samurai
             update_outer_ghosts(min_level - 1, field, other_fields...);
         }
         update_ghost_periodic(min_level, field, other_fields...);
-        update_ghost_subdomains(min_level, field, other_fields...);
+        if (min_level < max_level)
+        {
+            update_ghost_subdomains(min_level, field, other_fields...);
+        }
 
         for (std::size_t level = min_level + 1; level <= max_level; ++level)
         {
-            auto pred_ghosts = difference(mesh[mesh_id_t::all_cells][level],
-                                          union_(mesh[mesh_id_t::cells][level], mesh[mesh_id_t::proj_cells][level]));
-            auto expr        = intersection(pred_ghosts, mesh.subdomain(), mesh[mesh_id_t::all_cells][level - 1]).on(level);
+            auto& expr = cached_subset(mesh,
+                                       {"update_ghost_mr.prediction", level},
+                                       [&]()
+                                       {
+                                           auto pred_ghosts = difference(
+                                               mesh[mesh_id_t::all_cells][level],
+                                               union_(mesh[mesh_id_t::cells][level], mesh[mesh_id_t::proj_cells][level]));
+                                           auto ghosts = intersection(pred_ghosts, mesh.subdomain(), mesh[mesh_id_t::all_cells][level - 1]);
+                                           return ghosts.on(level);
+                                       });
 
             expr.apply_op(variadic_prediction<pred_order, false>(field, other_fields...));
             update_ghost_periodic(level, field, other_fields...);
-            update_ghost_subdomains(level, field, other_fields...);
+            if (level < max_level)
+            {
+                update_ghost_subdomains(level, field, other_fields...);
+            }
         }
+#ifdef SAMURAI_WITH_MPI
+        detail::post_halo_exchange(max_level, max_level, true, field, other_fields...);
+#endif
         // samurai::save(fs::current_path(), "update_ghosts", {true, true}, mesh, field);
 
         times::timers.stop("ghost update");
     }
 
+    /**
+     * Second half of the split-phase ghost update: waits for the ghost values posted
+     * by start_ghost_update, which must have been called with the same fields.
+     */
+    template <class Field, class... Fields>
+    void finish_ghost_update([[maybe_unused]] Field& field, [[maybe_unused]] Fields&... other_fields)
+    {
+#ifdef SAMURAI_WITH_MPI
+        times::timers.start("ghost update");
+        detail::complete_halo_exchange(
+            [](auto& local, const auto& received)
+            {
+                local = received;
+            },
+            field,
+            other_fields...);
+        times::timers.stop("ghost update");
+#endif
+    }
+
+    template <class Field, class... Fields>
+    void update_ghost_mr(Field& field, Fields&... other_fields)
+    {
+        start_ghost_update(field, other_fields...);
+        finish_ghost_update(field, other_fields...);
+    }
+
     inline void update_ghost_mr()
     {
     }
@@ -460,147 +559,378 @@ namespace samurai
         update_ghost_mr(fields.elements());
     }
 
+    template <class... T>
+    inline void start_ghost_update(Field_tuple<T...>& fields)
+    {
+        std::apply(
+            [](T&... tupleArgs)
+            {
+                start_ghost_update(tupleArgs...);
+            },
+            fields.elements());
+    }
+
+    template <class... T>
+    inline void finish_ghost_update(Field_tuple<T...>& fields)
+    {
+        std::apply(
+            [](T&... tupleArgs)
+            {
+                finish_ghost_update(tupleArgs...);
+            },
+            fields.elements());
+    }
+
+    namespace detail
+    {
+        template <bool to_send, class Mesh>
+        auto outer_subdomain_corner(std::size_t level, const Mesh& mesh, const typename Mesh::mpi_subdomain_t& neighbour)
+        {
+            using mesh_id_t  = typename Mesh::mesh_id_t;
+            using lca_t      = typename Mesh::lca_type;
+            using interval_t = typename Mesh::interval_t;
+            using coord_t    = typename lca_t::coord_type;
+
+            static constexpr std::size_t ghost_width = Mesh::config::ghost_width;
+
+            ArrayOfIntervalAndPoint<interval_t, coord_t> interval_list;
+
+            for_each_cartesian_direction<Mesh::dim>(
+                [&](auto bdry_direction_index, const auto& bdry_direction)
+                {
+                    if (!mesh.is_periodic(bdry_direction_index))
+                    {
+                        auto domain = self(mesh.domain()).on(level);
+                        auto& mesh1 = to_send ? mesh : neighbour.mesh;
+                        auto& mesh2 = to_send ? neighbour.mesh : mesh;
+
+                        auto my_boundary_ghosts = difference(
+                            intersection(mesh1[mesh_id_t::reference][level],
+                                         translate(domain, ghost_width * bdry_direction),
+                                         translate(self(mesh1.subdomain()).on(level), ghost_width * bdry_direction)),
+                            domain);
+
+                        auto neighbour_outer_corner = intersection(my_boundary_ghosts, mesh2[mesh_id_t::reference][level]);
+                        neighbour_outer_corner(
+                            [&](const auto& i, const auto& index)
+                            {
+                                interval_list.push_back(i, index);
+                            });
+                    }
+                });
+
+            interval_list.sort_intervals();
+
+            lca_t lca(level);
+            for (std::size_t k = 0; k < interval_list.size(); ++k)
+            {
+                const auto& [i, index] = interval_list[k];
+                lca.add_interval_back(i, index);
+            }
+
+            return lca;
+        }
+    }
+
     template <bool to_send, class Field>
     auto outer_subdomain_corner(std::size_t level, Field& field, const typename Field::mesh_t::mpi_subdomain_t& neighbour)
     {
-        using mesh_id_t  = typename Field::mesh_t::mesh_id_t;
-        using lca_t      = typename Field::mesh_t::lca_type;
-        using interval_t = typename Field::mesh_t::interval_t;
-        using coord_t    = typename lca_t::coord_type;
+        return detail::outer_subdomain_corner<to_send>(level, field.mesh(), neighbour);
+    }
 
-        static constexpr std::size_t ghost_width = Field::mesh_t::config::ghost_width;
+    namespace detail
+    {
+        /**
+         * Build the copy lists of the ghost exchange with each neighbouring subdomain.
+         * The cells sent to a neighbour are its ghosts on the interface with our
+         * subdomain plus the outer corners of the domain; they are listed in the
+         * same order as the neighbour lists the cells it receives from us.
+         */
+        template <class Mesh>
+        void build_halo_exchange_plan(Mesh& mesh)
+        {
+            using mesh_id_t = typename Mesh::mesh_id_t;
+            using index_t   = typename Mesh::index_t;
 
-        ArrayOfIntervalAndPoint<interval_t, coord_t> interval_list;
+            static constexpr std::size_t nb_levels = Mesh::max_refinement_level + 1;
 
-        auto& mesh = field.mesh();
-        for_each_cartesian_direction<Field::dim>(
-            [&](auto bdry_direction_index, const auto& bdry_direction)
+            auto& plan = mesh.halo_exchange_plan();
+            plan.neighbours.clear();
+            plan.neighbours.reserve(mesh.mpi_neighbourhood().size());
+
+            for (const auto& neighbour : mesh.mpi_neighbourhood())
             {
-                if (!mesh.is_periodic(bdry_direction_index))
+                auto& neighbour_plan = plan.neighbours.emplace_back();
+                neighbour_plan.rank  = neighbour.rank;
+
+                auto& send = neighbour_plan.send;
+                auto& recv = neighbour_plan.recv;
+                for (auto* list : {&send, &recv})
                 {
-                    auto domain = self(mesh.domain()).on(level);
-                    auto& mesh1 = to_send ? mesh : neighbour.mesh;
-                    auto& mesh2 = to_send ? neighbour.mesh : mesh;
-
-                    auto my_boundary_ghosts = difference(
-                        intersection(mesh1[mesh_id_t::reference][level],
-                                     translate(domain, ghost_width * bdry_direction),
-                                     translate(self(mesh1.subdomain()).on(level), ghost_width * bdry_direction)),
-                        domain);
-
-                    auto neighbour_outer_corner = intersection(my_boundary_ghosts, mesh2[mesh_id_t::reference][level]);
-                    neighbour_outer_corner(
-                        [&](const auto& i, const auto& index)
+                    list->level_offsets.assign(nb_levels + 1, 0);
+                    list->corner_offsets.assign(nb_levels, 0);
+                }
+
+                for (std::size_t level = 0; level < nb_levels; ++level)
+                {
+                    auto add_range = [&](auto& list)
+                    {
+                        return [&mesh, &list, level](const auto& i, const auto& index)
                         {
-                            interval_list.push_back(i, index);
-                        });
+                            const auto& interval = mesh.get_interval(level, i, index);
+                            list.ranges.push_back({interval.index + i.start, static_cast<index_t>(i.size())});
+                        };
+                    };
+
+                    send.level_offsets[level] = send.ranges.size();
+                    recv.level_offsets[level] = recv.ranges.size();
+
+                    if (!mesh[mesh_id_t::reference][level].empty() && !neighbour.mesh[mesh_id_t::reference][level].empty())
+                    {
+                        auto out_interface = intersection(mesh[mesh_id_t::reference][level],
+                                                          neighbour.mesh[mesh_id_t::reference][level],
+                                                          mesh.subdomain())
+                                                 .on(level);
+                        out_interface(add_range(send));
+
+                        auto in_interface = intersection(neighbour.mesh[mesh_id_t::reference][level],
+                                                         mesh[mesh_id_t::reference][level],
+                                                         neighbour.mesh.subdomain())
+                                                .on(level);
+                        in_interface(add_range(recv));
+
+                        send.corner_offsets[level] = send.ranges.size();
+                        recv.corner_offsets[level] = recv.ranges.size();
+
+                        auto add_corner = [](auto&& add)
+                        {
+                            return [add](const auto, const auto& i, const auto& index) mutable
+                            {
+                                add(i, index);
+                            };
+                        };
+                        for_each_interval(outer_subdomain_corner<true>(level, mesh, neighbour), add_corner(add_range(send)));
+                        for_each_interval(outer_subdomain_corner<false>(level, mesh, neighbour), add_corner(add_range(recv)));
+                    }
+                    else
+                    {
+                        send.corner_offsets[level] = send.ranges.size();
+                        recv.corner_offsets[level] = recv.ranges.size();
+                    }
                 }
-            });
+                send.level_offsets[nb_levels] = send.ranges.size();
+                recv.level_offsets[nb_levels] = recv.ranges.size();
+            }
+
+            plan.mesh_version = mesh.version();
+        }
+
+        template <class Mesh>
+        auto& get_halo_exchange_plan(Mesh& mesh)
+        {
+            auto& plan = mesh.halo_exchange_plan();
+            if (plan.mesh_version != mesh.version())
+            {
+                build_halo_exchange_plan(mesh);
+            }
+            return plan;
+        }
 
-        interval_list.sort_intervals();
+#ifdef SAMURAI_WITH_MPI
+        inline std::size_t halo_align(std::size_t pos, std::size_t alignment)
+        {
+            return (pos + alignment - 1) / alignment * alignment;
+        }
 
-        lca_t lca(level);
-        for (std::size_t k = 0; k < interval_list.size(); ++k)
+        // Number of bytes exchanged for the given levels and fields
+        template <class CopyList, class... Fields>
+        std::size_t halo_buffer_size(const CopyList& list, std::size_t min_level, std::size_t max_level, bool with_corners, const Fields&...)
         {
-            const auto& [i, index] = interval_list[k];
-            lca.add_interval_back(i, index);
+            std::size_t size = 0;
+            for (std::size_t level = min_level; level <= max_level; ++level)
+            {
+                std::size_t nb_cells = list.nb_cells(level, with_corners);
+                ((size = halo_align(size, alignof(typename Fields::value_type))
+                       + nb_cells * Fields::n_comp * sizeof(typename Fields::value_type)),
+                 ...);
+            }
+            return size;
         }
 
-        return lca;
-    }
+        template <class CopyList, class Field>
+        void halo_pack(const CopyList& list, std::size_t level, bool with_corners, const Field& field, std::vector<char>& buffer, std::size_t& pos)
+        {
+            using value_t = typename Field::value_type;
 
-    template <class Field>
-    void update_ghost_subdomains([[maybe_unused]] std::size_t level, [[maybe_unused]] Field& field)
-    {
-#ifdef SAMURAI_WITH_MPI
-        using mesh_t    = typename Field::mesh_t;
-        using value_t   = typename Field::value_type;
-        using mesh_id_t = typename mesh_t::mesh_id_t;
-        std::vector<mpi::request> req;
+            pos       = halo_align(pos, alignof(value_t));
+            auto* ptr = reinterpret_cast<value_t*>(buffer.data() + pos);
+            list.for_each_range(level,
+                                with_corners,
+                                [&](const auto& range)
+                                {
+                                    auto data = field.cells_view(range.offset, range.offset + range.length);
+                                    ptr       = std::copy(data.begin(), data.end(), ptr);
+                                });
+            pos = static_cast<std::size_t>(reinterpret_cast<char*>(ptr) - buffer.data());
+        }
 
-        auto& mesh = field.mesh();
-        mpi::communicator world;
-        std::vector<std::vector<value_t>> to_send(mesh.mpi_neighbourhood().size());
+        template <class CopyList, class Field, class Op>
+        void halo_unpack(const CopyList& list,
+                         std::size_t level,
+                         bool with_corners,
+                         Field& field,
+                         const std::vector<char>& buffer,
+                         std::size_t& pos,
+                         const Op& op)
+        {
+            using value_t = typename Field::value_type;
 
-        std::size_t i_neigh = 0;
-        for (auto& neighbour : mesh.mpi_neighbourhood())
+            pos       = halo_align(pos, alignof(value_t));
+            auto* ptr = reinterpret_cast<const value_t*>(buffer.data() + pos);
+            list.for_each_range(level,
+                                with_corners,
+                                [&](const auto& range)
+                                {
+                                    auto data = field.cells_view(range.offset, range.offset + range.length);
+                                    for (auto it = data.begin(); it != data.end(); ++it, ++ptr)
+                                    {
+                                        op(*it, *ptr);
+                                    }
+                                });
+            pos = static_cast<std::size_t>(reinterpret_cast<const char*>(ptr) - buffer.data());
+        }
+
+        /**
+         * Posts the exchange of the values of the fields on the levels [min_level, max_level]
+         * with the neighbouring subdomains: one nonblocking message per neighbour holds all
+         * the levels and all the fields. The exchange stays pending in the halo exchange plan
+         * of the mesh until complete_halo_exchange is called with the same fields.
+         */
+        template <class Field, class... Fields>
+        void post_halo_exchange(std::size_t min_level, std::size_t max_level, bool with_corners, Field& field, Fields&... other_fields)
         {
-            if (!mesh[mesh_id_t::reference][level].empty() && !neighbour.mesh[mesh_id_t::reference][level].empty())
+            auto& plan    = get_halo_exchange_plan(field.mesh());
+            auto& pending = plan.pending;
+            // the mesh holds a single pending exchange
+            if (pending.active)
             {
-                auto out_interface = intersection(mesh[mesh_id_t::reference][level],
-                                                  neighbour.mesh[mesh_id_t::reference][level],
-                                                  mesh.subdomain())
-                                         .on(level);
-                out_interface(
-                    [&](const auto& i, const auto& index)
-                    {
-                        std::copy(field(level, i, index).begin(), field(level, i, index).end(), std::back_inserter(to_send[i_neigh]));
-                    });
-                auto subdomain_corners = outer_subdomain_corner<true>(level, field, neighbour);
-                for_each_interval(
-                    subdomain_corners,
-                    [&](const auto, const auto& i, const auto& index)
-                    {
-                        std::copy(field(level, i, index).begin(), field(level, i, index).end(), std::back_inserter(to_send[i_neigh]));
-                    });
+                throw std::logic_error("A ghost update is already in flight on this mesh: call finish_ghost_update before exchanging ghosts again.");
+            }
+
+            mpi::communicator world;
+            auto& req = pending.requests;
+            req.clear();
+            req.reserve(2 * plan.neighbours.size());
 
-                req.push_back(world.isend(neighbour.rank, neighbour.rank, to_send[i_neigh++]));
+            for (auto& neighbour : plan.neighbours)
+            {
+                std::size_t size = halo_buffer_size(neighbour.recv, min_level, max_level, with_corners, field, other_fields...);
+                neighbour.recv_buffer.resize(size);
+                if (size > 0)
+                {
+                    req.push_back(world.irecv(neighbour.rank, world.rank(), neighbour.recv_buffer.data(), static_cast<int>(size)));
+                }
             }
+
+            for (auto& neighbour : plan.neighbours)
+            {
+                std::size_t size = halo_buffer_size(neighbour.send, min_level, max_level, with_corners, field, other_fields...);
+                neighbour.send_buffer.resize(size);
+                if (size > 0)
+                {
+                    std::size_t pos = 0;
+                    for (std::size_t level = min_level; level <= max_level; ++level)
+                    {
+                        halo_pack(neighbour.send, level, with_corners, field, neighbour.send_buffer, pos);
+                        (halo_pack(neighbour.send, level, with_corners, other_fields, neighbour.send_buffer, pos), ...);
+                    }
+                    req.push_back(world.isend(neighbour.rank, neighbour.rank, neighbour.send_buffer.data(), static_cast<int>(size)));
+                }
+            }
+
+            pending.active       = true;
+            pending.min_level    = min_level;
+            pending.max_level    = max_level;
+            pending.with_corners = with_corners;
         }
 
-        for (auto& neighbour : mesh.mpi_neighbourhood())
+        /**
+         * Waits for the pending exchange and combines the received values with the
+         * local ones by op(local, received).
+         */
+        template <class Op, class Field, class... Fields>
+        void complete_halo_exchange(const Op& op, Field& field, Fields&... other_fields)
         {
-            if (!mesh[mesh_id_t::reference][level].empty() && !neighbour.mesh[mesh_id_t::reference][level].empty())
+            auto& plan    = field.mesh().halo_exchange_plan();
+            auto& pending = plan.pending;
+            if (!pending.active)
             {
-                std::vector<value_t> to_recv;
-                std::ptrdiff_t count = 0;
-
-                world.recv(neighbour.rank, world.rank(), to_recv);
-                auto in_interface = intersection(neighbour.mesh[mesh_id_t::reference][level],
-                                                 mesh[mesh_id_t::reference][level],
-                                                 neighbour.mesh.subdomain())
-                                        .on(level);
-                in_interface(
-                    [&](const auto& i, const auto& index)
+                return;
+            }
+
+            mpi::wait_all(pending.requests.begin(), pending.requests.end());
+
+            for (auto& neighbour : plan.neighbours)
+            {
+                if (!neighbour.recv_buffer.empty())
+                {
+                    std::size_t pos = 0;
+                    for (std::size_t level = pending.min_level; level <= pending.max_level; ++level)
                     {
-                        std::copy(to_recv.begin() + count,
-                                  to_recv.begin() + count + static_cast<ptrdiff_t>(i.size() * Field::n_comp),
-                                  field(level, i, index).begin());
-                        count += static_cast<ptrdiff_t>(i.size() * Field::n_comp);
-                    });
-                auto subdomain_corners = outer_subdomain_corner<false>(level, field, neighbour);
-                for_each_interval(subdomain_corners,
-                                  [&](const auto, const auto& i, const auto& index)
-                                  {
-                                      std::copy(to_recv.begin() + count,
-                                                to_recv.begin() + count + static_cast<ptrdiff_t>(i.size() * Field::n_comp),
-                                                field(level, i, index).begin());
-                                      count += static_cast<ptrdiff_t>(i.size() * Field::n_comp);
-                                  });
+                        halo_unpack(neighbour.recv, level, pending.with_corners, field, neighbour.recv_buffer, pos, op);
+                        (halo_unpack(neighbour.recv, level, pending.with_corners, other_fields, neighbour.recv_buffer, pos, op), ...);
+                    }
+                }
             }
+
+            pending.active = false;
+            pending.requests.clear();
+        }
+
+        /**
+         * Exchange the values of the fields on the levels [min_level, max_level] with
+         * the neighbouring subdomains (see post_halo_exchange). The received values are
+         * combined with the local ones by op(local, received).
+         */
+        template <class Op, class Field, class... Fields>
+        void exchange_halo(std::size_t min_level, std::size_t max_level, bool with_corners, const Op& op, Field& field, Fields&... other_fields)
+        {
+            post_halo_exchange(min_level, max_level, with_corners, field, other_fields...);
+            complete_halo_exchange(op, field, other_fields...);
         }
-        mpi::wait_all(req.begin(), req.end());
 #endif
     }
 
     template <class Field, class... Fields>
-    void update_ghost_subdomains(std::size_t level, Field& field, Fields&... other_fields)
+    void update_ghost_subdomains([[maybe_unused]] std::size_t level, [[maybe_unused]] Field& field, [[maybe_unused]] Fields&... other_fields)
     {
-        update_ghost_subdomains(level, field);
-        update_ghost_subdomains(level, other_fields...);
+#ifdef SAMURAI_WITH_MPI
+        detail::exchange_halo(
+            level,
+            level,
+            true,
+            [](auto& local, const auto& received)
+            {
+                local = received;
+            },
+            field,
+            other_fields...);
+#endif
     }
 
     template <class Field>
     void update_ghost_subdomains([[maybe_unused]] Field& field)
     {
 #ifdef SAMURAI_WITH_MPI
-        mpi::communicator world;
-        auto& mesh     = field.mesh();
-        auto max_level = mesh.max_level();
-        for (std::size_t level = 0; level <= max_level; ++level)
-        {
-            update_ghost_subdomains(level, field);
-        }
+        detail::exchange_halo(
+            0,
+            field.mesh().max_level(),
+            true,
+            [](auto& local, const auto& received)
+            {
+                local = received;
+            },
+            field);
 #endif
     }
 
@@ -608,66 +938,22 @@ namespace samurai
     void update_tag_subdomains([[maybe_unused]] std::size_t level, [[maybe_unused]] Field& tag, [[maybe_unused]] bool erase = false)
     {
 #ifdef SAMURAI_WITH_MPI
-        using mesh_t    = typename Field::mesh_t;
-        using value_t   = typename Field::value_type;
-        using mesh_id_t = typename mesh_t::mesh_id_t;
-        std::vector<mpi::request> req;
-
-        auto& mesh = tag.mesh();
-        mpi::communicator world;
-        std::vector<std::vector<value_t>> to_send(mesh.mpi_neighbourhood().size());
-
-        std::size_t i_neigh = 0;
-        for (auto& neighbour : mesh.mpi_neighbourhood())
-        {
-            if (!mesh[mesh_id_t::reference][level].empty() && !neighbour.mesh[mesh_id_t::reference][level].empty())
+        detail::exchange_halo(
+            level,
+            level,
+            false,
+            [erase](auto& local, const auto& received)
             {
-                auto out_interface = intersection(mesh[mesh_id_t::reference][level],
-                                                  neighbour.mesh[mesh_id_t::reference][level],
-                                                  mesh.subdomain())
-                                         .on(level);
-                out_interface(
-                    [&](const auto& i, const auto& index)
-                    {
-                        std::copy(tag(level, i, index).begin(), tag(level, i, index).end(), std::back_inserter(to_send[i_neigh]));
-                    });
-
-                req.push_back(world.isend(neighbour.rank, neighbour.rank, to_send[i_neigh++]));
-            }
-        }
-
-        for (auto& neighbour : mesh.mpi_neighbourhood())
-        {
-            if (!mesh[mesh_id_t::reference][level].empty() && !neighbour.mesh[mesh_id_t::reference][level].empty())
-            {
-                std::vector<value_t> to_recv;
-                std::ptrdiff_t count = 0;
-
-                world.recv(neighbour.rank, world.rank(), to_recv);
-
-                auto in_interface = intersection(mesh[mesh_id_t::reference][level],
-                                                 neighbour.mesh[mesh_id_t::reference][level],
-                                                 neighbour.mesh.subdomain())
-                                        .on(level);
-                in_interface(
-                    [&](const auto& i, const auto& index)
-                    {
-                        xt::xtensor<value_t, 1> neigh_tag = xt::empty_like(tag(level, i, index));
-                        std::copy(to_recv.begin() + count, to_recv.begin() + count + static_cast<std::ptrdiff_t>(i.size()), neigh_tag.begin());
-                        if (erase)
-                        {
-                            tag(level, i, index) = neigh_tag;
-                        }
-                        else
-                        {
-                            tag(level, i, index) |= neigh_tag;
-                        }
-                        count += static_cast<std::ptrdiff_t>(i.size());
-                    });
-            }
-        }
-        mpi::wait_all(req.begin(), req.end());
-
+                if (erase)
+                {
+                    local = received;
+                }
+                else
+                {
+                    local |= received;
+                }
+            },
+            tag);
 #endif
     }
 
@@ -1266,11 +1552,12 @@ namespace samurai
         using mesh_t                     = typename Tag::mesh_t;
         using size_type                  = typename Tag::size_type;
         using mesh_id_t                  = typename Tag::mesh_t::mesh_id_t;
-        using cl_type                    = typename Tag::mesh_t::cl_type;
+        using ca_type                    = typename Tag::mesh_t::ca_type;
+        using flat_cl_type               = typename ca_type::flat_cl_type;
 
         auto& mesh = tag.mesh();
 
-        cl_type cl;
+        flat_cl_type cl;
 
         for_each_interval(mesh[mesh_id_t::cells],
                           [&](std::size_t level, const auto& interval, const auto& index)
@@ -1313,7 +1600,7 @@ namespace samurai
                               }
                           });
 
-        mesh_t new_mesh = {cl, mesh};
+        mesh_t new_mesh = {ca_type{cl, false}, mesh};
 
 #ifdef SAMURAI_WITH_MPI
         mpi::communicator world;
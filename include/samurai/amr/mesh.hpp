@@ -63,6 +63,9 @@ namespace samurai::amr
         using cl_type   = typename base_type::cl_type;
         using lcl_type  = typename base_type::lcl_type;
 
+        using flat_cl_type  = typename base_type::ca_type::flat_cl_type;
+        using flat_lcl_type = typename flat_cl_type::lcl_type;
+
         using ca_type  = typename base_type::ca_type;
         using lca_type = typename base_type::lca_type;
 
@@ -113,11 +116,11 @@ namespace samurai::amr
     template <class Config>
     inline void Mesh<Config>::update_sub_mesh_impl()
     {
-        cl_type cl;
+        flat_cl_type cl;
         for_each_interval(this->cells()[mesh_id_t::cells],
                           [&](std::size_t level, const auto& interval, const auto& index_yz)
                           {
-                              lcl_type& lcl = cl[level];
+                              flat_lcl_type& lcl = cl[level];
                               static_nested_loop<dim - 1, -config::ghost_width, config::ghost_width + 1>(
                                   [&](auto stencil)
                                   {
@@ -139,7 +142,7 @@ namespace samurai::amr
                                    this->cells()[mesh_id_t::cells][level - 1])
                             .on(level);
 
-            lcl_type lcl{level};
+            flat_lcl_type lcl{level};
             expr(
                 [&](const auto& interval, const auto& index_yz)
                 {
@@ -156,7 +159,7 @@ namespace samurai::amr
                                                 union_(this->get_union()[level], this->cells()[mesh_id_t::cells][level])),
                                      self(this->domain()).on(level));
 
-            lcl_type lcl{level};
+            flat_lcl_type lcl{level};
             expr(
                 [&](const auto& interval, const auto& index_yz)
                 {
@@ -170,7 +173,7 @@ namespace samurai::amr
         {
             auto expr = intersection(this->cells()[mesh_id_t::pred_cells][level], this->cells()[mesh_id_t::pred_cells][level]).on(level - 1);
 
-            lcl_type& lcl = cl[level - 1];
+            flat_lcl_type& lcl = cl[level - 1];
 
             expr(
                 [&](const auto& interval, const auto& index_yz)
@@ -188,7 +191,7 @@ namespace samurai::amr
 
         for (std::size_t level = min_level; level <= max_level; ++level)
         {
-            lcl_type lcl{level};
+            flat_lcl_type lcl{level};
             auto expr = union_(this->cells()[mesh_id_t::cells_and_ghosts][level], this->cells()[mesh_id_t::proj_cells][level]);
             expr(
                 [&](const auto& interval, const auto& index_yz)
@@ -2,18 +2,69 @@
 // SPDX-License-Identifier:  BSD-3-Clause
 #pragma once
 
+#include <cstddef>
+#include <map>
+#include <string>
+
 #include <CLI/CLI.hpp>
 
 namespace samurai
 {
+    /**
+     * How the explicit non-linear flux-based schemes accumulate the interface
+     * contributions into the output field when OpenMP is enabled.
+     *  - Atomic: each contribution is added with an atomic update;
+     *  - Binned: the contributions are first stored per thread, then each thread
+     *    adds those of the cells it owns (no atomic operation).
+     * In both modes, the order in which the contributions to a cell are added depends on
+     * the scheduling of the threads: the results may differ by rounding errors from one run to the next.
+     */
+    enum class FluxAccumulation
+    {
+        Atomic,
+        Binned
+    };
+
+    /**
+     * How the initial mesh is distributed among the MPI processes.
+     *  - Intervals: contiguous stripes of x-intervals of the domain;
+     *  - Morton, Hilbert: pieces of equal number of cells along a space-filling curve,
+     *    which give compact subdomains (the Hilbert ones being the most compact).
+     */
+    enum class MeshPartitioner
+    {
+        Intervals,
+        Morton,
+        Hilbert
+    };
+
+    /**
+     * Order of the cells of a level in the storage of the fields (see Mesh_base::numbering).
+     * The levels are stored one after the other in both cases.
+     *  - Rows: all the cells of the reference mesh, row by row;
+     *  - LeavesFirst: the x-intervals of the reference mesh which contain leaves, then the other ones
+     *    (ghosts only), so that the loops on the leaves of a level do not stream over the ghost rows.
+     */
+    enum class CellNumbering
+    {
+        Rows,
+        LeavesFirst
+    };
+
     namespace args
     {
         static bool timers = false;
 #ifdef SAMURAI_WITH_MPI
-        static bool dont_redirect_output = false;
+        static bool dont_redirect_output       = false;
+        static double load_balancing_threshold = 0;
 #endif
-        static bool enable_max_level_flux = false;
-        static bool refine_boundary       = false;
+        static bool enable_max_level_flux         = false;
+        static bool refine_boundary               = false;
+        static bool disable_mr_kernels            = false;
+        static FluxAccumulation flux_accumulation = FluxAccumulation::Atomic;
+        static MeshPartitioner partitioner        = MeshPartitioner::Intervals;
+        static CellNumbering numbering            = CellNumbering::Rows;
+        static std::size_t stencil_tile_bytes     = 256 * 1024;
     }
 
     inline void read_samurai_arguments(CLI::App& app, int& argc, char**& argv)
@@ -28,6 +79,39 @@ namespace samurai
             ->capture_default_str()
             ->group("SAMURAI");
         app.add_flag("--refine-boundary", args::refine_boundary, "Keep the boundary refined at max_level")->capture_default_str()->group("SAMURAI");
+        app.add_flag("--disable-mr-kernels",
+                     args::disable_mr_kernels,
+                     "Compute the prediction and the details with the generic expressions instead of the vectorized kernels")
+            ->capture_default_str()
+            ->group("SAMURAI");
+        app.add_option("--flux-accumulation", args::flux_accumulation, "Accumulation of the non-linear fluxes in parallel: atomic or binned")
+            ->transform(CLI::CheckedTransformer(std::map<std::string, FluxAccumulation>{{"atomic", FluxAccumulation::Atomic},
+                                                                                        {"binned", FluxAccumulation::Binned}},
+                                                CLI::ignore_case))
+            ->group("SAMURAI");
+        app.add_option("--stencil-tile-bytes",
+                       args::stencil_tile_bytes,
+                       "Size of the blocks of rows traversed together by the 3D stencils spanning several planes (0: no blocks)")
+            ->capture_default_str()
+            ->group("SAMURAI");
+        app.add_option("--cell-numbering", args::numbering, "Order of the cells in the fields: rows or leaves-first")
+            ->transform(CLI::CheckedTransformer(std::map<std::string, CellNumbering>{{"rows", CellNumbering::Rows},
+                                                                                     {"leaves-first", CellNumbering::LeavesFirst}},
+                                                CLI::ignore_case))
+            ->group("SAMURAI");
+#ifdef SAMURAI_WITH_MPI
+        app.add_option("--partitioner", args::partitioner, "Partitioning of the initial mesh: intervals, morton or hilbert")
+            ->transform(CLI::CheckedTransformer(std::map<std::string, MeshPartitioner>{{"intervals", MeshPartitioner::Intervals},
+                                                                                       {"morton", MeshPartitioner::Morton},
+                                                                                       {"hilbert", MeshPartitioner::Hilbert}},
+                                                CLI::ignore_case))
+            ->group("SAMURAI");
+        app.add_option("--load-balancing-threshold",
+                       args::load_balancing_threshold,
+                       "Repartition the mesh after the adaptation when the load imbalance exceeds this value (0: never)")
+            ->capture_default_str()
+            ->group("SAMURAI");
+#endif
         app.allow_extras();
         app.set_help_flag("", ""); // deactivate --help option
         try
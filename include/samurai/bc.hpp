@@ -15,6 +15,7 @@
 #include "static_algorithm.hpp"
 #include "stencil.hpp"
 #include "storage/containers.hpp"
+#include "subset_cache.hpp"
 #include "utils.hpp"
 
 #define APPLY_AND_STENCIL_FUNCTIONS(STENCIL_SIZE)                                                                                         \
@@ -615,6 +616,7 @@ namespace samurai
         auto on(const Regions&... regions);
 
         const region_t& get_region() const;
+        SubsetCache<dim, interval_t>& subset_cache();
 
         value_t constant_value();
         value_t value(const direction_t& d, const cell_t& cell_in, const coords_t& coords) const;
@@ -625,6 +627,7 @@ namespace samurai
         bcvalue_impl p_bcvalue;
         const lca_t& m_domain; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
         region_t m_region;
+        SubsetCache<dim, interval_t> m_subset_cache;
         // xt::xtensor<typename Field::value_type, detail::return_type<typename Field::value_type, n_comp>::dim> m_value;
     };
 
@@ -659,6 +662,7 @@ namespace samurai
         : p_bcvalue(bc.p_bcvalue->clone())
         , m_domain(bc.m_domain)
         , m_region(bc.m_region)
+        , m_subset_cache(bc.m_subset_cache)
     {
     }
 
@@ -672,7 +676,8 @@ namespace samurai
         bcvalue_impl bcvalue = bc.p_bcvalue->clone();
         std::swap(p_bcvalue, bcvalue);
         m_domain = bc.m_domain;
-        m_region = bc.m_region;
+        m_region       = bc.m_region;
+        m_subset_cache = bc.m_subset_cache;
         return *this;
     }
 
@@ -688,6 +693,7 @@ namespace samurai
         {
             m_region = make_bc_region<dim, interval_t>(region).get_region(m_domain);
         }
+        m_subset_cache.clear();
         return this;
     }
 
@@ -696,6 +702,7 @@ namespace samurai
     inline auto Bc<Field>::on(const Regions&... regions)
     {
         m_region = make_bc_region<dim, interval_t>(regions...).get_region(m_domain);
+        m_subset_cache.clear();
         return this;
     }
 
@@ -705,6 +712,16 @@ namespace samurai
         return m_region;
     }
 
+    /**
+     * Boundary cells of the region materialized for the mesh version (see apply_bc_impl).
+     * It is emptied when the region changes.
+     */
+    template <class Field>
+    inline auto Bc<Field>::subset_cache() -> SubsetCache<dim, interval_t>&
+    {
+        return m_subset_cache;
+    }
+
     template <class Field>
     inline auto Bc<Field>::constant_value() -> value_t
     {
@@ -899,10 +916,14 @@ namespace samurai
                     auto stencil          = convert_for_direction(stencil_0, direction);
                     auto stencil_analyzer = make_stencil_analyzer(stencil);
 
-                    // Inner cells in the boundary region
-                    auto bdry_cells = intersection(mesh[mesh_id_t::cells][level], region_lca[d]).on(level);
                     if (level >= mesh.min_level()) // otherwise there is no cells
                     {
+                        // Inner cells in the boundary region
+                        auto make_bdry_cells = [&]()
+                        {
+                            return intersection(mesh[mesh_id_t::cells][level], region_lca[d]).on(level);
+                        };
+                        auto& bdry_cells = bc.subset_cache().get(mesh.version(), {"apply_bc", level, {static_cast<int>(d)}}, make_bdry_cells);
                         __apply_bc_on_subset(bc, field, bdry_cells, stencil_analyzer, direction);
                     }
                 }
@@ -83,13 +83,16 @@ namespace samurai
         using cl_type    = CellList<dim, TInterval, max_size>;
         using coords_t   = typename lca_type::coords_t;
 
+        using flat_cl_type = CellList<dim, TInterval, max_size, FlatLevelCellList<dim, TInterval>>;
+
         using iterator               = CellArray_iterator<self_type, false>;
         using reverse_iterator       = CellArray_reverse_iterator<iterator>;
         using const_iterator         = CellArray_iterator<const self_type, true>;
         using const_reverse_iterator = CellArray_reverse_iterator<const_iterator>;
 
         CellArray();
-        CellArray(const cl_type& cl, bool with_update_index = true);
+        template <class TLevelCellList>
+        CellArray(const CellList<dim_, TInterval, max_size_, TLevelCellList>& cl, bool with_update_index = true);
 
         const lca_type& operator[](std::size_t i) const;
         lca_type& operator[](std::size_t i);
@@ -258,7 +261,9 @@ namespace samurai
      * x-intervals must be computed.
      */
     template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline CellArray<dim_, TInterval, max_size_>::CellArray(const cl_type& cl, bool with_update_index)
+    template <class TLevelCellList>
+    inline CellArray<dim_, TInterval, max_size_>::CellArray(const CellList<dim_, TInterval, max_size_, TLevelCellList>& cl,
+                                                             bool with_update_index)
     {
         for (std::size_t level = 0; level <= max_size; ++level)
         {
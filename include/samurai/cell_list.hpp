@@ -7,6 +7,7 @@
 
 #include <fmt/color.h>
 
+#include "flat_level_cell_list.hpp"
 #include "level_cell_list.hpp"
 #include "samurai_config.hpp"
 
@@ -17,7 +18,16 @@ namespace samurai
     // CellList definition //
     /////////////////////////
 
-    template <std::size_t dim_, class TInterval = default_config::interval_t, std::size_t max_size_ = default_config::max_level>
+    /**
+     * List of cells for all levels.
+     *
+     * @tparam TLevelCellList The cell list of one level: LevelCellList (nested maps of
+     * forward lists) or FlatLevelCellList (flat array sorted on conversion).
+     */
+    template <std::size_t dim_,
+              class TInterval       = default_config::interval_t,
+              std::size_t max_size_ = default_config::max_level,
+              class TLevelCellList  = LevelCellList<dim_, TInterval>>
     class CellList
     {
       public:
@@ -25,7 +35,7 @@ namespace samurai
         static constexpr auto dim      = dim_;
         static constexpr auto max_size = max_size_;
 
-        using lcl_type = LevelCellList<dim, TInterval>;
+        using lcl_type = TLevelCellList;
         using coords_t = typename lcl_type::coords_t;
 
         CellList();
@@ -53,8 +63,8 @@ namespace samurai
     /**
      * Default contructor which sets the level for each LevelCellArray.
      */
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline CellList<dim_, TInterval, max_size_>::CellList()
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, class TLevelCellList>
+    inline CellList<dim_, TInterval, max_size_, TLevelCellList>::CellList()
     {
         for (std::size_t level = 0; level <= max_size; ++level)
         {
@@ -62,8 +72,8 @@ namespace samurai
         }
     }
 
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline CellList<dim_, TInterval, max_size_>::CellList(const coords_t& origin_point, double scaling_factor)
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, class TLevelCellList>
+    inline CellList<dim_, TInterval, max_size_, TLevelCellList>::CellList(const coords_t& origin_point, double scaling_factor)
     {
         for (std::size_t level = 0; level <= max_size; ++level)
         {
@@ -71,20 +81,20 @@ namespace samurai
         }
     }
 
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline auto CellList<dim_, TInterval, max_size_>::operator[](std::size_t i) const -> const lcl_type&
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, class TLevelCellList>
+    inline auto CellList<dim_, TInterval, max_size_, TLevelCellList>::operator[](std::size_t i) const -> const lcl_type&
     {
         return m_cells[i];
     }
 
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline auto CellList<dim_, TInterval, max_size_>::operator[](std::size_t i) -> lcl_type&
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, class TLevelCellList>
+    inline auto CellList<dim_, TInterval, max_size_, TLevelCellList>::operator[](std::size_t i) -> lcl_type&
     {
         return m_cells[i];
     }
 
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline void CellList<dim_, TInterval, max_size_>::to_stream(std::ostream& os) const
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, class TLevelCellList>
+    inline void CellList<dim_, TInterval, max_size_, TLevelCellList>::to_stream(std::ostream& os) const
     {
         for (std::size_t level = 0; level <= max_size; ++level)
         {
@@ -94,20 +104,20 @@ namespace samurai
         }
     }
 
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline auto& CellList<dim_, TInterval, max_size_>::origin_point() const
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, class TLevelCellList>
+    inline auto& CellList<dim_, TInterval, max_size_, TLevelCellList>::origin_point() const
     {
         return m_cells[0].origin_point();
     }
 
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline auto CellList<dim_, TInterval, max_size_>::scaling_factor() const
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, class TLevelCellList>
+    inline auto CellList<dim_, TInterval, max_size_, TLevelCellList>::scaling_factor() const
     {
         return m_cells[0].scaling_factor();
     }
 
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline void CellList<dim_, TInterval, max_size_>::clear()
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, class TLevelCellList>
+    inline void CellList<dim_, TInterval, max_size_, TLevelCellList>::clear()
     {
         for (std::size_t level = 0; level <= max_size; ++level)
         {
@@ -115,8 +125,8 @@ namespace samurai
         }
     }
 
-    template <std::size_t dim_, class TInterval, std::size_t max_size_>
-    inline std::ostream& operator<<(std::ostream& out, const CellList<dim_, TInterval, max_size_>& cell_list)
+    template <std::size_t dim_, class TInterval, std::size_t max_size_, class TLevelCellList>
+    inline std::ostream& operator<<(std::ostream& out, const CellList<dim_, TInterval, max_size_, TLevelCellList>& cell_list)
     {
         cell_list.to_stream(out);
         return out;
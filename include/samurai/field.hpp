@@ -187,6 +187,17 @@ namespace samurai
                 return data;
             }
 
+            // Contiguous cells [start, end) of the storage, without any mesh search
+            inline auto cells_view(index_t start, index_t end)
+            {
+                return view(m_storage, {start, end, 1});
+            }
+
+            inline auto cells_view(index_t start, index_t end) const
+            {
+                return view(m_storage, {start, end, 1});
+            }
+
             void resize()
             {
                 m_storage.resize(static_cast<size_type>(this->derived_cast().mesh().nb_cells()));
@@ -311,6 +322,17 @@ namespace samurai
                             {interval_tmp.index + interval.start, interval_tmp.index + interval.end, interval.step});
             }
 
+            // Contiguous cells [start, end) of the storage, without any mesh search
+            inline auto cells_view(index_t start, index_t end)
+            {
+                return view(m_storage, {start, end, 1});
+            }
+
+            inline auto cells_view(index_t start, index_t end) const
+            {
+                return view(m_storage, {start, end, 1});
+            }
+
             void resize()
             {
                 m_storage.resize(static_cast<size_type>(this->derived_cast().mesh().nb_cells()));
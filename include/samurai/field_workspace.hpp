@@ -0,0 +1,177 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace samurai
+{
+    /**
+     * Pool of field storages attached to a mesh.
+     *
+     * The storages are recycled by (container type, mesh version): the container
+     * type encodes the value type and the number of components of the field,
+     * and the version guarantees that a recycled storage has the right size.
+     * Once the pool is warm, acquiring and releasing a storage only swaps
+     * containers, without any allocation.
+     * The workspace is not thread-safe: it must be used outside of parallel regions.
+     */
+    class FieldWorkspace
+    {
+      public:
+
+        FieldWorkspace() = default;
+
+        // The storages are bound to the cells of the mesh they come from: a copy starts empty.
+        FieldWorkspace(const FieldWorkspace&)
+        {
+        }
+
+        FieldWorkspace& operator=(const FieldWorkspace&)
+        {
+            m_entries.clear();
+            return *this;
+        }
+
+        FieldWorkspace(FieldWorkspace&&) noexcept            = default;
+        FieldWorkspace& operator=(FieldWorkspace&&) noexcept = default;
+
+        /**
+         * Swaps a free storage of the mesh version into container.
+         * Returns false if there is none, in which case container is left unchanged.
+         */
+        template <class Container>
+        bool acquire(std::size_t mesh_version, Container& container)
+        {
+            for (auto& entry : m_entries)
+            {
+                if (!entry.in_use && entry.version == mesh_version && entry.type == std::type_index(typeid(Container)))
+                {
+                    using std::swap;
+                    swap(static_cast<buffer<Container>&>(*entry.storage).data, container);
+                    entry.in_use = true;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * Gives back a storage of the mesh version to the pool.
+         * It takes the place of a lent storage of the same type or, failing that,
+         * of a free storage of an older mesh version.
+         */
+        template <class Container>
+        void release(std::size_t mesh_version, Container& container)
+        {
+            entry_t* slot = nullptr;
+            for (auto& entry : m_entries)
+            {
+                if (entry.type == std::type_index(typeid(Container)) && (entry.in_use || entry.version != mesh_version))
+                {
+                    slot = &entry;
+                    if (entry.in_use)
+                    {
+                        break;
+                    }
+                }
+            }
+            if (slot == nullptr)
+            {
+                m_entries.push_back({std::type_index(typeid(Container)), mesh_version, false, std::make_unique<buffer<Container>>()});
+                slot = &m_entries.back();
+            }
+            using std::swap;
+            swap(static_cast<buffer<Container>&>(*slot->storage).data, container);
+            slot->version = mesh_version;
+            slot->in_use  = false;
+        }
+
+        /// Number of storages owned by the pool, lent or not.
+        std::size_t size() const
+        {
+            return m_entries.size();
+        }
+
+        void clear()
+        {
+            m_entries.clear();
+        }
+
+      private:
+
+        struct buffer_base
+        {
+            virtual ~buffer_base() = default;
+        };
+
+        template <class Container>
+        struct buffer : buffer_base
+        {
+            Container data;
+        };
+
+        struct entry_t
+        {
+            std::type_index type;
+            std::size_t version;
+            bool in_use;
+            std::unique_ptr<buffer_base> storage;
+        };
+
+        std::vector<entry_t> m_entries;
+    };
+
+    /**
+     * Field whose storage is taken from the workspace of its mesh and given back
+     * on destruction. The field has no name and its values are not initialized.
+     */
+    template <class Field>
+    class WorkspaceField
+    {
+      public:
+
+        using field_t = Field;
+        using mesh_t  = typename Field::mesh_t;
+
+        explicit WorkspaceField(mesh_t& mesh)
+            : m_workspace(&mesh.field_workspace())
+            , m_version(mesh.version())
+        {
+            m_field.change_mesh_ptr(mesh);
+            if (!m_workspace->acquire(m_version, m_field.array()))
+            {
+                m_field.resize();
+            }
+        }
+
+        WorkspaceField(const WorkspaceField&)            = delete;
+        WorkspaceField& operator=(const WorkspaceField&) = delete;
+
+        ~WorkspaceField()
+        {
+            m_workspace->release(m_version, m_field.array());
+        }
+
+        Field& field()
+        {
+            return m_field;
+        }
+
+        const Field& field() const
+        {
+            return m_field;
+        }
+
+      private:
+
+        FieldWorkspace* m_workspace;
+        std::size_t m_version;
+        Field m_field;
+    };
+}
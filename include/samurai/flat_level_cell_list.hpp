@@ -0,0 +1,388 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <xtensor/xfixed.hpp>
+#include <xtensor/xview.hpp>
+
+#include "cell.hpp"
+#include "interval.hpp"
+#include "samurai_config.hpp"
+
+namespace samurai
+{
+    namespace detail
+    {
+        /** Stable LSD radix sort of n records on a signed integer key.
+         *
+         * The key is shifted by its minimum so that only the bytes that
+         * actually vary are sorted. The sorted records are in data or in buffer
+         * (the pointers are swapped after each pass).
+         */
+        template <class Record, class Key>
+        inline void radix_sort_by_key(Record*& data, Record*& buffer, std::size_t n, Key&& key)
+        {
+            using key_t  = std::decay_t<decltype(key(*data))>;
+            using ukey_t = std::make_unsigned_t<key_t>;
+
+            auto min = key(data[0]);
+            auto max = min;
+            for (std::size_t i = 1; i < n; ++i)
+            {
+                min = std::min(min, key(data[i]));
+                max = std::max(max, key(data[i]));
+            }
+
+            const auto digit_of = [&](const Record& record, int shift)
+            {
+                return static_cast<std::size_t>((static_cast<ukey_t>(static_cast<ukey_t>(key(record)) - static_cast<ukey_t>(min)) >> shift)
+                                                & 0xFF);
+            };
+
+            const auto range = static_cast<ukey_t>(static_cast<ukey_t>(max) - static_cast<ukey_t>(min));
+            for (int shift = 0; shift < std::numeric_limits<ukey_t>::digits && (range >> shift) != 0; shift += 8)
+            {
+                std::array<std::size_t, 257> count{};
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    ++count[digit_of(data[i], shift) + 1];
+                }
+                for (std::size_t d = 1; d < count.size(); ++d)
+                {
+                    count[d] += count[d - 1];
+                }
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    buffer[count[digit_of(data[i], shift)]++] = data[i];
+                }
+                std::swap(data, buffer);
+            }
+        }
+    } // namespace detail
+
+    //////////////////////////////////
+    // FlatLevelCellList definition //
+    //////////////////////////////////
+
+    /** @class FlatLevelCellList
+     *  @brief Cell list of one level stored as a flat array of x-intervals.
+     *
+     * It has the same building API as LevelCellList but the intervals are only
+     * appended to a contiguous buffer: they are sorted by (yz, x) with a radix
+     * sort and merged when a LevelCellArray is built from the list.
+     *
+     * @tparam Dim The dimension.
+     * @tparam TInterval The interval type.
+     */
+    template <std::size_t Dim, class TInterval = default_config::interval_t>
+    class FlatLevelCellList
+    {
+      public:
+
+        static constexpr auto dim = Dim;
+        using interval_t          = TInterval;
+        using index_t             = typename interval_t::index_t;
+        using coord_index_t       = typename interval_t::coord_index_t;
+        using index_yz_t          = xt::xtensor_fixed<coord_index_t, xt::xshape<dim - 1>>;
+        using coords_t            = xt::xtensor_fixed<double, xt::xshape<dim>>;
+
+        /// x-interval [start, end[ at the dim-1 coordinates yz
+        struct record_t
+        {
+            std::array<coord_index_t, dim - 1> yz;
+            coord_index_t start;
+            coord_index_t end;
+        };
+
+        /// Proxy returned by operator[] to add intervals at given dim-1 coordinates
+        class row_t
+        {
+          public:
+
+            row_t(FlatLevelCellList& lcl, const index_yz_t& index);
+
+            void add_point(coord_index_t point);
+            void add_interval(const interval_t& interval);
+
+          private:
+
+            FlatLevelCellList* p_lcl;
+            std::array<coord_index_t, dim - 1> m_yz;
+        };
+
+        FlatLevelCellList();
+        FlatLevelCellList(std::size_t level);
+        FlatLevelCellList(std::size_t level, const coords_t& origin_point, double scaling_factor);
+
+        row_t operator[](const index_yz_t& index);
+
+        std::size_t level() const;
+
+        bool empty() const;
+
+        void to_stream(std::ostream& os) const;
+
+        void add_cell(const Cell<dim, interval_t>& cell);
+        void add_interval(const interval_t& interval, const std::array<coord_index_t, dim - 1>& yz);
+
+        auto& origin_point() const;
+        double scaling_factor() const;
+
+        void reserve(std::size_t nb_intervals);
+        void clear();
+
+        const std::vector<record_t>& records() const;
+
+      private:
+
+        void compact() const;
+
+        static bool record_less(const record_t& lhs, const record_t& rhs);
+        static bool same_row(const record_t& lhs, const record_t& rhs);
+
+        mutable std::vector<record_t> m_records; ///< Appended intervals
+        mutable std::vector<record_t> m_buffer;  ///< Work array of the radix sort
+        mutable std::size_t m_nb_sorted = 0;     ///< The first m_nb_sorted records are sorted and merged
+        std::size_t m_level;
+        coords_t m_origin_point;
+        double m_scaling_factor = 1;
+    };
+
+    //////////////////////////////////////
+    // FlatLevelCellList implementation //
+    //////////////////////////////////////
+    template <std::size_t Dim, class TInterval>
+    inline FlatLevelCellList<Dim, TInterval>::row_t::row_t(FlatLevelCellList& lcl, const index_yz_t& index)
+        : p_lcl(&lcl)
+    {
+        std::copy(index.cbegin(), index.cend(), m_yz.begin());
+    }
+
+    /// Add a point at the coordinates of the row.
+    template <std::size_t Dim, class TInterval>
+    inline void FlatLevelCellList<Dim, TInterval>::row_t::add_point(coord_index_t point)
+    {
+        p_lcl->add_interval({point, point + 1}, m_yz);
+    }
+
+    /// Add an interval at the coordinates of the row.
+    template <std::size_t Dim, class TInterval>
+    inline void FlatLevelCellList<Dim, TInterval>::row_t::add_interval(const interval_t& interval)
+    {
+        p_lcl->add_interval(interval, m_yz);
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline FlatLevelCellList<Dim, TInterval>::FlatLevelCellList()
+        : m_level{0}
+    {
+        m_origin_point.fill(0);
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline FlatLevelCellList<Dim, TInterval>::FlatLevelCellList(std::size_t level)
+        : m_level{level}
+    {
+        m_origin_point.fill(0);
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline FlatLevelCellList<Dim, TInterval>::FlatLevelCellList(std::size_t level, const coords_t& origin_point, double scaling_factor)
+        : m_level{level}
+        , m_origin_point(origin_point)
+        , m_scaling_factor(scaling_factor)
+    {
+    }
+
+    /// Access to the x-intervals at given dim-1 coordinates
+    template <std::size_t Dim, class TInterval>
+    inline auto FlatLevelCellList<Dim, TInterval>::operator[](const index_yz_t& index) -> row_t
+    {
+        return {*this, index};
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline std::size_t FlatLevelCellList<Dim, TInterval>::level() const
+    {
+        return m_level;
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline bool FlatLevelCellList<Dim, TInterval>::empty() const
+    {
+        return m_records.empty();
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline void FlatLevelCellList<Dim, TInterval>::to_stream(std::ostream& os) const
+    {
+        os << "FlatLevelCellList\n";
+        os << "=================\n";
+        for (const auto& record : records())
+        {
+            for (std::size_t d = 0; d < dim - 1; ++d)
+            {
+                os << record.yz[d] << " ";
+            }
+            os << "[" << record.start << "," << record.end << "[\n";
+        }
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline void FlatLevelCellList<Dim, TInterval>::add_cell(const Cell<dim, interval_t>& cell)
+    {
+        std::array<coord_index_t, dim - 1> yz;
+        for (std::size_t d = 0; d < dim - 1; ++d)
+        {
+            yz[d] = cell.indices[d + 1];
+        }
+        add_interval({cell.indices[0], cell.indices[0] + 1}, yz);
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline void FlatLevelCellList<Dim, TInterval>::add_interval(const interval_t& interval, const std::array<coord_index_t, dim - 1>& yz)
+    {
+        if (!interval.is_valid())
+        {
+            return;
+        }
+        m_records.push_back({yz, interval.start, interval.end});
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline auto& FlatLevelCellList<Dim, TInterval>::origin_point() const
+    {
+        return m_origin_point;
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline double FlatLevelCellList<Dim, TInterval>::scaling_factor() const
+    {
+        return m_scaling_factor;
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline void FlatLevelCellList<Dim, TInterval>::reserve(std::size_t nb_intervals)
+    {
+        m_records.reserve(nb_intervals);
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline void FlatLevelCellList<Dim, TInterval>::clear()
+    {
+        m_records.clear();
+        m_nb_sorted = 0;
+    }
+
+    /// Intervals sorted by (yz, x) and merged: there is no overlapping or contiguous intervals on a same row.
+    template <std::size_t Dim, class TInterval>
+    inline auto FlatLevelCellList<Dim, TInterval>::records() const -> const std::vector<record_t>&
+    {
+        compact();
+        return m_records;
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline bool FlatLevelCellList<Dim, TInterval>::record_less(const record_t& lhs, const record_t& rhs)
+    {
+        for (std::size_t d = dim - 1; d > 0; --d)
+        {
+            if (lhs.yz[d - 1] != rhs.yz[d - 1])
+            {
+                return lhs.yz[d - 1] < rhs.yz[d - 1];
+            }
+        }
+        return lhs.start < rhs.start;
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline bool FlatLevelCellList<Dim, TInterval>::same_row(const record_t& lhs, const record_t& rhs)
+    {
+        return lhs.yz == rhs.yz;
+    }
+
+    /**
+     * Sort the records appended since the last call and merge them with the
+     * already sorted ones.
+     */
+    template <std::size_t Dim, class TInterval>
+    inline void FlatLevelCellList<Dim, TInterval>::compact() const
+    {
+        static constexpr std::size_t radix_sort_threshold = 256;
+
+        if (m_nb_sorted == m_records.size())
+        {
+            return;
+        }
+
+        auto first          = m_records.begin() + static_cast<std::ptrdiff_t>(m_nb_sorted);
+        const std::size_t n = m_records.size() - m_nb_sorted;
+
+        if (n < radix_sort_threshold)
+        {
+            std::sort(first, m_records.end(), record_less);
+        }
+        else
+        {
+            m_buffer.resize(n);
+            record_t* data   = m_records.data() + m_nb_sorted;
+            record_t* buffer = m_buffer.data();
+
+            // from the least significant key to the most significant one
+            detail::radix_sort_by_key(data,
+                                      buffer,
+                                      n,
+                                      [](const record_t& r)
+                                      {
+                                          return r.start;
+                                      });
+            for (std::size_t d = 0; d < dim - 1; ++d)
+            {
+                detail::radix_sort_by_key(data,
+                                          buffer,
+                                          n,
+                                          [d](const record_t& r)
+                                          {
+                                              return r.yz[d];
+                                          });
+            }
+            if (data != m_records.data() + m_nb_sorted)
+            {
+                std::copy(data, data + n, first);
+            }
+        }
+        std::inplace_merge(m_records.begin(), first, m_records.end(), record_less);
+
+        // merge the overlapping and contiguous intervals of each row
+        std::size_t last = 0;
+        for (std::size_t r = 1; r < m_records.size(); ++r)
+        {
+            if (same_row(m_records[last], m_records[r]) && m_records[r].start <= m_records[last].end)
+            {
+                m_records[last].end = std::max(m_records[last].end, m_records[r].end);
+            }
+            else
+            {
+                m_records[++last] = m_records[r];
+            }
+        }
+        m_records.resize(last + 1);
+        m_nb_sorted = m_records.size();
+    }
+
+    template <std::size_t Dim, class TInterval>
+    inline std::ostream& operator<<(std::ostream& out, const FlatLevelCellList<Dim, TInterval>& level_cell_list)
+    {
+        level_cell_list.to_stream(out);
+        return out;
+    }
+
+} // namespace samurai
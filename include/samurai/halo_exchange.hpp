@@ -0,0 +1,122 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#ifdef SAMURAI_WITH_MPI
+#include <boost/mpi/request.hpp>
+#endif
+
+namespace samurai
+{
+    /**
+     * Communication plan of the ghost exchange between MPI subdomains.
+     *
+     * For each neighbouring subdomain, it stores the ranges of contiguous
+     * cells of the field storage to send and to receive, level by level.
+     * On a given level, the ranges of the subdomain interface come first,
+     * followed by those of the outer corners of the domain.
+     * The plan is built from the subset intersections once per mesh version
+     * and the exchange buffers are kept from one exchange to the next.
+     * It also records the exchange started by start_ghost_update until
+     * finish_ghost_update completes it.
+     */
+    template <class index_t>
+    struct HaloExchangePlan
+    {
+        struct cell_range
+        {
+            index_t offset; // index of the first cell in the field storage
+            index_t length; // number of cells
+        };
+
+        struct copy_list
+        {
+            // ranges of level l: [level_offsets[l], level_offsets[l + 1])
+            // among them, [level_offsets[l], corner_offsets[l]) are on the subdomain interface
+            std::vector<cell_range> ranges;
+            std::vector<std::size_t> level_offsets;
+            std::vector<std::size_t> corner_offsets;
+
+            std::size_t nb_cells(std::size_t level, bool with_corners) const
+            {
+                std::size_t n = 0;
+                if (level + 1 < level_offsets.size())
+                {
+                    auto end = with_corners ? level_offsets[level + 1] : corner_offsets[level];
+                    for (std::size_t r = level_offsets[level]; r < end; ++r)
+                    {
+                        n += static_cast<std::size_t>(ranges[r].length);
+                    }
+                }
+                return n;
+            }
+
+            template <class Func>
+            void for_each_range(std::size_t level, bool with_corners, Func&& f) const
+            {
+                if (level + 1 < level_offsets.size())
+                {
+                    auto end = with_corners ? level_offsets[level + 1] : corner_offsets[level];
+                    for (std::size_t r = level_offsets[level]; r < end; ++r)
+                    {
+                        f(ranges[r]);
+                    }
+                }
+            }
+        };
+
+        struct neighbour_plan
+        {
+            int rank;
+            copy_list send;
+            copy_list recv;
+            std::vector<char> send_buffer;
+            std::vector<char> recv_buffer;
+        };
+
+        // Exchange posted but not completed
+        struct pending_exchange
+        {
+            bool active           = false;
+            std::size_t min_level = 0;
+            std::size_t max_level = 0;
+            bool with_corners     = false;
+#ifdef SAMURAI_WITH_MPI
+            std::vector<boost::mpi::request> requests;
+#endif
+        };
+
+        std::size_t mesh_version = 0;
+        std::vector<neighbour_plan> neighbours;
+        pending_exchange pending;
+
+        /**
+         * Calls f(first, last) for the ranges [first, last) of the field storage
+         * whose values are received by the pending exchange.
+         */
+        template <class Func>
+        void for_each_pending_range(Func&& f) const
+        {
+            if (!pending.active)
+            {
+                return;
+            }
+            for (const auto& neighbour : neighbours)
+            {
+                for (std::size_t level = pending.min_level; level <= pending.max_level; ++level)
+                {
+                    neighbour.recv.for_each_range(level,
+                                                  pending.with_corners,
+                                                  [&](const auto& range)
+                                                  {
+                                                      f(range.offset, range.offset + range.length);
+                                                  });
+                }
+            }
+        }
+    };
+}
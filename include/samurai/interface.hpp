@@ -28,6 +28,55 @@ namespace samurai
         }
     }
 
+    namespace detail
+    {
+        /**
+         * Calls @p apply_on_interface(cells, shifted_cells) for all the pairs of sets whose
+         * intersection gives the interfaces of same level in the chosen direction
+         * (including the periodic and MPI neighbour ones).
+         */
+        template <class Mesh, class Func>
+        void for_each_interface_set__same_level(const Mesh& mesh,
+                                                std::size_t level,
+                                                const DirectionVector<Mesh::dim>& direction,
+                                                Func&& apply_on_interface)
+        {
+            static constexpr std::size_t dim = Mesh::dim;
+            using mesh_id_t                  = typename Mesh::mesh_id_t;
+
+            apply_on_interface(mesh[mesh_id_t::cells][level], translate(mesh[mesh_id_t::cells][level], -direction));
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                if (mesh.periodicity()[d])
+                {
+                    auto shift = get_periodic_shift(mesh.domain(), level, d);
+                    apply_on_interface(mesh[mesh_id_t::cells][level],
+                                       translate(translate(mesh[mesh_id_t::cells][level], shift), -direction));
+                    apply_on_interface(translate(mesh[mesh_id_t::cells][level], -shift),
+                                       translate(mesh[mesh_id_t::cells][level], -direction));
+                }
+            }
+#ifdef SAMURAI_WITH_MPI
+            for (const auto& neigh : mesh.mpi_neighbourhood())
+            {
+                apply_on_interface(mesh[mesh_id_t::cells][level], translate(neigh.mesh[mesh_id_t::cells][level], -direction));
+                apply_on_interface(neigh.mesh[mesh_id_t::cells][level], translate(mesh[mesh_id_t::cells][level], -direction));
+                for (std::size_t d = 0; d < dim; ++d)
+                {
+                    if (mesh.periodicity()[d])
+                    {
+                        auto shift = get_periodic_shift(mesh.domain(), level, d);
+                        apply_on_interface(mesh[mesh_id_t::cells][level],
+                                           translate(translate(neigh.mesh[mesh_id_t::cells][level], shift), -direction));
+                        apply_on_interface(translate(neigh.mesh[mesh_id_t::cells][level], -shift),
+                                           translate(mesh[mesh_id_t::cells][level], -direction));
+                    }
+                }
+            }
+#endif
+        }
+    }
+
     /**
      * Iterates over the interfaces of same level only (no level jump).
      * Same parameters as the preceding function.
@@ -40,7 +89,6 @@ namespace samurai
                                                  Func&& f)
     {
         static constexpr std::size_t dim = Mesh::dim;
-        using mesh_id_t                  = typename Mesh::mesh_id_t;
         using mesh_interval_t            = typename Mesh::mesh_interval_t;
 
         Stencil<2, dim> interface_stencil_ = in_out_stencil<dim>(direction);
@@ -76,34 +124,83 @@ namespace samurai
                     apply_on_interval<get_type>(mesh_interval, interface_it, comput_stencil_it, std::forward<Func>(f));
                 });
         };
-        apply_on_interface(mesh[mesh_id_t::cells][level], translate(mesh[mesh_id_t::cells][level], -direction));
-        for (std::size_t d = 0; d < dim; ++d)
+        detail::for_each_interface_set__same_level(mesh, level, direction, apply_on_interface);
+    }
+
+    /**
+     * Iterates over the interfaces of same level only (no level jump), using precomputed neighbour indices.
+     * The connectivities are (re)built only if the mesh has changed since the last call:
+     * in the other cases, no search in the mesh is performed.
+     * In 3D, the interfaces are traversed by tiles of y-rows when the stencil spans several z-planes
+     * (see StencilConnectivity::tile).
+     */
+    template <Run run_type = Run::Sequential, Get get_type = Get::Cells, class Mesh, std::size_t comput_stencil_size, class Func>
+    void for_each_interior_interface__same_level(const Mesh& mesh,
+                                                 std::size_t level,
+                                                 const DirectionVector<Mesh::dim>& direction,
+                                                 const StencilAnalyzer<comput_stencil_size, Mesh::dim>& comput_stencil,
+                                                 StencilConnectivity<Mesh, 2>& interface_connectivity,
+                                                 StencilConnectivity<Mesh, comput_stencil_size>& comput_stencil_connectivity,
+                                                 Func&& f)
+    {
+        static constexpr std::size_t dim = Mesh::dim;
+        using mesh_interval_t            = typename Mesh::mesh_interval_t;
+
+        Stencil<2, dim> interface_stencil_ = in_out_stencil<dim>(direction);
+        auto interface_stencil             = make_stencil_analyzer(interface_stencil_);
+
+        if (!interface_connectivity.is_up_to_date(mesh, level, interface_stencil)
+            || !comput_stencil_connectivity.is_up_to_date(mesh, level, comput_stencil))
         {
-            if (mesh.periodicity()[d])
-            {
-                auto shift = get_periodic_shift(mesh.domain(), level, d);
-                apply_on_interface(mesh[mesh_id_t::cells][level], translate(translate(mesh[mesh_id_t::cells][level], shift), -direction));
-                apply_on_interface(translate(mesh[mesh_id_t::cells][level], -shift), translate(mesh[mesh_id_t::cells][level], -direction));
-            }
+            interface_connectivity.reset(mesh, level, interface_stencil);
+            comput_stencil_connectivity.reset(mesh, level, comput_stencil);
+            detail::for_each_interface_set__same_level(mesh,
+                                                       level,
+                                                       direction,
+                                                       [&](const auto& cells, const auto& shifted_cells)
+                                                       {
+                                                           auto intersect = intersection(cells, shifted_cells);
+                                                           for_each_meshinterval<mesh_interval_t>(intersect,
+                                                                                                  [&](const auto& mesh_interval)
+                                                                                                  {
+                                                                                                      interface_connectivity.add(mesh, mesh_interval);
+                                                                                                      comput_stencil_connectivity.add(mesh,
+                                                                                                                                      mesh_interval);
+                                                                                                  });
+                                                       });
+            auto rows_per_tile = comput_stencil_connectivity.rows_per_tile(level);
+            interface_connectivity.tile(level, rows_per_tile);
+            comput_stencil_connectivity.tile(level, rows_per_tile);
         }
-#ifdef SAMURAI_WITH_MPI
-        for (const auto& neigh : mesh.mpi_neighbourhood())
+
+        auto n_intervals = static_cast<std::ptrdiff_t>(interface_connectivity.nb_intervals(level));
+
+#pragma omp parallel if (run_type == Run::Parallel)
         {
-            apply_on_interface(mesh[mesh_id_t::cells][level], translate(neigh.mesh[mesh_id_t::cells][level], -direction));
-            apply_on_interface(neigh.mesh[mesh_id_t::cells][level], translate(mesh[mesh_id_t::cells][level], -direction));
-            for (std::size_t d = 0; d < dim; ++d)
+            auto interface_it      = make_stencil_iterator(mesh, interface_stencil);
+            auto comput_stencil_it = make_stencil_iterator(mesh, comput_stencil);
+
+#pragma omp for
+            for (std::ptrdiff_t k = 0; k < n_intervals; ++k)
             {
-                if (mesh.periodicity()[d])
+                interface_connectivity.init(interface_it, level, static_cast<std::size_t>(k));
+                comput_stencil_connectivity.init(comput_stencil_it, level, static_cast<std::size_t>(k));
+
+                if constexpr (get_type == Get::Intervals)
                 {
-                    auto shift = get_periodic_shift(mesh.domain(), level, d);
-                    apply_on_interface(mesh[mesh_id_t::cells][level],
-                                       translate(translate(neigh.mesh[mesh_id_t::cells][level], shift), -direction));
-                    apply_on_interface(translate(neigh.mesh[mesh_id_t::cells][level], -shift),
-                                       translate(mesh[mesh_id_t::cells][level], -direction));
+                    f(interface_it, comput_stencil_it);
+                }
+                else if constexpr (get_type == Get::Cells)
+                {
+                    for (std::size_t ii = 0; ii < interface_it.interval().size(); ++ii)
+                    {
+                        f(interface_it.cells(), comput_stencil_it.cells());
+                        interface_it.move_next();
+                        comput_stencil_it.move_next();
+                    }
                 }
             }
         }
-#endif
     }
 
     /**
@@ -145,17 +145,63 @@ namespace samurai
         return std::make_pair(coords, connectivity);
     }
 
+    /**
+     * Native interval representation of a mesh: one row (level, start, end, y, z) per
+     * x-interval, in the order of the cells in the saved fields.
+     */
+    template <class Mesh>
+    auto extract_intervals(const Mesh& mesh)
+    {
+        static constexpr std::size_t dim = Mesh::dim;
+        using value_t                    = typename Mesh::interval_t::value_t;
+
+        std::size_t nb_intervals = 0;
+        for_each_interval(mesh,
+                          [&](std::size_t, const auto&, const auto&)
+                          {
+                              ++nb_intervals;
+                          });
+
+        xt::xtensor<value_t, 2> intervals = xt::empty<value_t>({nb_intervals, dim + 2});
+
+        std::size_t row = 0;
+        for_each_interval(mesh,
+                          [&](std::size_t level, const auto& i, const auto& index)
+                          {
+                              intervals(row, 0) = static_cast<value_t>(level);
+                              intervals(row, 1) = i.start;
+                              intervals(row, 2) = i.end;
+                              for (std::size_t d = 0; d < dim - 1; ++d)
+                              {
+                                  intervals(row, 3 + d) = index[d];
+                              }
+                              ++row;
+                          });
+        return intervals;
+    }
+
+    /**
+     * Options of the HDF5 output.
+     *  - by_level: one grid per level;
+     *  - by_mesh_id: one grid per mesh id;
+     *  - compact: the geometry is saved as the intervals of the mesh (see extract_intervals)
+     *    instead of the points and the connectivity of every cell. The XDMF file then has
+     *    no Topology and no Geometry: it cannot be opened by ParaView or VisIt. This output is
+     *    meant to be read by python/read_mesh.py, which rebuilds the cells from the intervals.
+     */
     template <class D>
     struct Hdf5Options
     {
-        Hdf5Options(bool level = false, bool mesh_id = false)
+        Hdf5Options(bool level = false, bool mesh_id = false, bool compact_output = false)
             : by_level(level)
             , by_mesh_id(mesh_id)
+            , compact(compact_output)
         {
         }
 
         bool by_level   = false;
         bool by_mesh_id = false;
+        bool compact    = false;
     };
 
     template <class Config>
@@ -164,12 +210,14 @@ namespace samurai
     template <class Config>
     struct Hdf5Options<UniformMesh<Config>>
     {
-        Hdf5Options(bool mesh_id = false)
+        Hdf5Options(bool mesh_id = false, bool compact_output = false)
             : by_mesh_id(mesh_id)
+            , compact(compact_output)
         {
         }
 
         bool by_mesh_id;
+        bool compact;
     };
 
     template <class D>
@@ -200,6 +248,10 @@ namespace samurai
         template <class Submesh>
         void save_on_mesh(pugi::xml_node& grid_parent, const std::string& prefix, const Submesh& submesh, const std::string& mesh_name);
 
+        template <class Submesh>
+        void
+        save_intervals_on_mesh(pugi::xml_node& grid_parent, const std::string& prefix, const Submesh& submesh, const std::string& mesh_name);
+
         template <class Submesh, class Field>
         inline void save_field(pugi::xml_node& grid, const std::string& prefix, const Submesh& submesh, const Field& field);
 
@@ -247,6 +299,8 @@ namespace samurai
         const derived_type& derived_cast() const& noexcept;
         derived_type derived_cast() && noexcept;
 
+        bool compact_output() const;
+
       protected:
 
         const mesh_t& mesh() const;
@@ -327,6 +381,12 @@ namespace samurai
         return m_options;
     }
 
+    template <class D, class Mesh, class... T>
+    inline bool SaveBase<D, Mesh, T...>::compact_output() const
+    {
+        return m_options.compact;
+    }
+
     template <class D, class Mesh, class... T>
     class SaveCellArray : public SaveBase<D, Mesh, T...>
     {
@@ -528,6 +588,12 @@ namespace samurai
     {
         static constexpr std::size_t dim = derived_type_save::dim;
 
+        if (this->derived_cast().compact_output())
+        {
+            save_intervals_on_mesh(grid_parent, prefix, submesh, mesh_name);
+            return;
+        }
+
         xt::xtensor<std::size_t, 2> local_connectivity;
         xt::xtensor<double, 2> local_coords;
         std::tie(local_coords, local_connectivity) = extract_coords_and_connectivity(submesh);
@@ -678,6 +744,113 @@ namespace samurai
         }
     }
 
+    template <class D>
+    template <class Submesh>
+    inline void Hdf5<D>::save_intervals_on_mesh(pugi::xml_node& grid_parent,
+                                                const std::string& prefix,
+                                                const Submesh& submesh,
+                                                const std::string& mesh_name)
+    {
+        static constexpr std::size_t dim     = derived_type_save::dim;
+        static constexpr std::size_t nb_cols = dim + 2;
+        using value_t                        = typename Submesh::interval_t::value_t;
+
+        auto local_intervals = extract_intervals(submesh);
+
+#ifdef SAMURAI_WITH_MPI
+        mpi::communicator world;
+
+        auto rank = static_cast<std::size_t>(world.rank());
+        auto size = static_cast<std::size_t>(world.size());
+
+        xt::xtensor<std::size_t, 1> intervals_sizes = xt::empty<std::size_t>({size});
+        mpi::all_gather(world, local_intervals.shape(0), intervals_sizes.begin());
+#else
+        std::size_t rank                                              = 0;
+        std::size_t size                                              = 1;
+        xt::xtensor_fixed<std::size_t, xt::xshape<1>> intervals_sizes = {local_intervals.shape(0)};
+#endif
+
+        if (xt::sum(intervals_sizes)() == 0)
+        {
+            return;
+        }
+
+        // geometry of the cells: corner = origin_point + index * scaling_factor / 2^level
+        std::vector<double> origin_point(submesh.origin_point().cbegin(), submesh.origin_point().cend());
+        double scaling_factor = submesh.scaling_factor();
+
+        auto xfer_props = HighFive::DataTransferProps{};
+#ifdef SAMURAI_WITH_MPI
+        xfer_props.add(HighFive::UseCollectiveIO{});
+#endif
+        auto write_intervals = [&](const std::string& path, std::size_t r)
+        {
+            auto intervals = h5_file.createDataSet<value_t>(path, HighFive::DataSpace(std::vector<std::size_t>{intervals_sizes[r], nb_cols}));
+            intervals.createAttribute<double>("origin_point", HighFive::DataSpace::From(origin_point)).write(origin_point);
+            intervals.createAttribute<double>("scaling_factor", HighFive::DataSpace::From(scaling_factor)).write(scaling_factor);
+
+            std::vector<std::size_t> slice_size(2, 0);
+            const value_t* data_ptr = nullptr;
+            if (rank == r && intervals_sizes[r] != 0)
+            {
+                slice_size = {intervals_sizes[r], nb_cols};
+                data_ptr   = local_intervals.data();
+            }
+            auto intervals_slice = intervals.select({0, 0}, slice_size);
+            intervals_slice.write_raw(data_ptr, HighFive::AtomicType<value_t>{}, xfer_props);
+        };
+
+        auto add_information = [&](pugi::xml_node& grid, const std::string& path)
+        {
+            auto info                      = grid.append_child("Information");
+            info.append_attribute("Name")  = "intervals";
+            info.append_attribute("Value") = fmt::format("{}.h5:{}", m_filename, path).data();
+        };
+
+        if (size == 1)
+        {
+            write_intervals(prefix + "/intervals", rank);
+        }
+        else
+        {
+            for (std::size_t r = 0; r < size; ++r)
+            {
+                if (intervals_sizes[r] != 0)
+                {
+                    write_intervals(prefix + fmt::format("/rank_{}/intervals", r), r);
+                }
+            }
+        }
+
+        auto grid = grid_parent.append_child("Grid");
+        if (rank == 0)
+        {
+            if (size == 1)
+            {
+                grid.append_attribute("Name") = mesh_name.data();
+                add_information(grid, prefix + "/intervals");
+            }
+            else
+            {
+                grid.append_attribute("GridType")       = "Collection";
+                grid.append_attribute("CollectionType") = "Spatial";
+                for (std::size_t irank = 0; irank < size; ++irank)
+                {
+                    if (intervals_sizes[irank] != 0)
+                    {
+                        auto subgrid                     = grid.append_child("Grid");
+                        subgrid.append_attribute("Name") = fmt::format("{}_rank_{}", mesh_name, irank).data();
+                        subgrid.append_attribute("Rank") = irank;
+                        add_information(subgrid, prefix + fmt::format("/rank_{}/intervals", irank));
+                    }
+                }
+            }
+        }
+
+        this->derived_cast().save_fields(grid, prefix, submesh);
+    }
+
     template <class D>
     template <class Submesh, class Field>
     inline void Hdf5<D>::save_field(pugi::xml_node& grid, const std::string& prefix, const Submesh& submesh, const Field& field)
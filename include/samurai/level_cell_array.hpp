@@ -19,6 +19,7 @@
 
 #include "algorithm.hpp"
 #include "box.hpp"
+#include "flat_level_cell_list.hpp"
 #include "interval.hpp"
 #include "level_cell_list.hpp"
 #include "mesh_interval.hpp"
@@ -93,6 +94,7 @@ namespace samurai
 
         LevelCellArray() = default;
         LevelCellArray(const LevelCellList<Dim, TInterval>& lcl);
+        LevelCellArray(const FlatLevelCellList<Dim, TInterval>& lcl);
 
         template <class Op, class StartEndOp, class... S>
         LevelCellArray(Subset<Op, StartEndOp, S...> set);
@@ -226,6 +228,9 @@ namespace samurai
                                        const std::array<value_t, dim - 1>& index,
                                        std::integral_constant<std::size_t, 0>);
 
+        /// Construction from the sorted and merged intervals of a flat level cell list
+        void init_from_flat_level_cell_list(const FlatLevelCellList<Dim, TInterval>& lcl);
+
         void init_from_box(const Box<value_t, dim>& box);
         void init_from_box(const Box<double, dim>& box, const coords_t& origin_point, double approx_box_tol, double scaling_factor);
 
@@ -340,6 +345,24 @@ namespace samurai
         }
     }
 
+    template <std::size_t Dim, class TInterval>
+    inline LevelCellArray<Dim, TInterval>::LevelCellArray(const FlatLevelCellList<Dim, TInterval>& lcl)
+        : m_level(lcl.level())
+        , m_origin_point(lcl.origin_point())
+        , m_scaling_factor(lcl.scaling_factor())
+    {
+        if (!lcl.empty())
+        {
+            init_from_flat_level_cell_list(lcl);
+            // Additionnal offset so that [m_offset[i], m_offset[i+1][ is always
+            // valid.
+            for (std::size_t d = 0; d < dim - 1; ++d)
+            {
+                m_offsets[d].emplace_back(m_cells[d].size());
+            }
+        }
+    }
+
     template <std::size_t Dim, class TInterval>
     template <class Op, class StartEndOp, class... S>
     inline LevelCellArray<Dim, TInterval>::LevelCellArray(Subset<Op, StartEndOp, S...> set)
@@ -1020,6 +1043,77 @@ namespace samurai
         std::copy(interval_list.begin(), interval_list.end(), std::back_inserter(m_cells[0]));
     }
 
+    template <std::size_t Dim, class TInterval>
+    inline void LevelCellArray<Dim, TInterval>::init_from_flat_level_cell_list(const FlatLevelCellList<Dim, TInterval>& lcl)
+    {
+        const auto& records = lcl.records();
+
+        m_cells[0].reserve(records.size());
+
+        // Working intervals along the dimensions > 0
+        std::array<interval_t, dim> curr_interval;
+        curr_interval.fill(interval_t(0, 0, 0));
+
+        // Push the working interval of the dimension d
+        auto close_interval = [&](std::size_t d)
+        {
+            if (curr_interval[d].is_valid())
+            {
+                m_cells[d].emplace_back(curr_interval[d]);
+                curr_interval[d] = interval_t(0, 0, 0);
+            }
+        };
+
+        // Add the point i along the dimension d: continue the working interval or create a new one
+        auto add_point = [&](std::size_t d, value_t i)
+        {
+            if (curr_interval[d].is_valid() && i == curr_interval[d].end)
+            {
+                ++curr_interval[d].end;
+            }
+            else
+            {
+                close_interval(d);
+                curr_interval[d] = interval_t(i, i + 1, static_cast<index_t>(m_offsets[d - 1].size()) - i);
+            }
+            m_offsets[d - 1].emplace_back(m_cells[d - 1].size());
+        };
+
+        for (std::size_t r = 0; r < records.size(); ++r)
+        {
+            const auto& record = records[r];
+
+            // Highest dimension where the coordinate changes with respect to the previous row
+            std::size_t d_new = (r == 0 || records[r - 1].yz != record.yz) ? dim - 1 : 0;
+            if (r > 0)
+            {
+                while (d_new > 0 && records[r - 1].yz[d_new - 1] == record.yz[d_new - 1])
+                {
+                    --d_new;
+                }
+            }
+
+            if (d_new > 0)
+            {
+                for (std::size_t d = 1; d < d_new; ++d)
+                {
+                    close_interval(d);
+                }
+                for (std::size_t d = d_new; d > 0; --d)
+                {
+                    add_point(d, record.yz[d - 1]);
+                }
+            }
+
+            m_cells[0].emplace_back(record.start, record.end);
+        }
+
+        for (std::size_t d = 1; d < dim; ++d)
+        {
+            close_interval(d);
+        }
+    }
+
     template <std::size_t Dim, class TInterval>
     inline void LevelCellArray<Dim, TInterval>::init_from_box(const Box<value_t, dim>& box)
     {
@@ -0,0 +1,419 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "algorithm.hpp"
+#include "arguments.hpp"
+#include "field.hpp"
+#include "space_filling_curve.hpp"
+#include "timers.hpp"
+
+namespace samurai
+{
+    /**
+     * Weight of a cell in the load of its subdomain: all the cells cost the same.
+     */
+    struct uniform_load_weight
+    {
+        template <class Cell>
+        double operator()(const Cell&) const
+        {
+            return 1.;
+        }
+    };
+
+    /**
+     * Weight ratio^level: with a local time stepping, a cell of level l+1 is
+     * updated `ratio` times more often than a cell of level l.
+     */
+    struct level_load_weight
+    {
+        double ratio = 2.;
+
+        template <class Cell>
+        double operator()(const Cell& cell) const
+        {
+            return std::pow(ratio, static_cast<double>(cell.level));
+        }
+    };
+
+    /**
+     * Relative excess of the most loaded subdomain over the mean load (0 when the load is perfectly balanced).
+     * The load of a subdomain is the sum of the weights of its cells.
+     */
+    template <class Mesh, class Weight = uniform_load_weight>
+    double load_imbalance([[maybe_unused]] const Mesh& mesh, [[maybe_unused]] const Weight& weight = {})
+    {
+#ifdef SAMURAI_WITH_MPI
+        using mesh_id_t = typename Mesh::mesh_id_t;
+
+        double load = 0;
+        for_each_cell(mesh[mesh_id_t::cells],
+                      [&](const auto& cell)
+                      {
+                          load += weight(cell);
+                      });
+
+        mpi::communicator world;
+        double max_load   = mpi::all_reduce(world, load, mpi::maximum<double>());
+        double total_load = mpi::all_reduce(world, load, std::plus<double>());
+        double mean_load  = total_load / world.size();
+        return mean_load > 0 ? max_load / mean_load - 1 : 0;
+#else
+        return 0;
+#endif
+    }
+
+    namespace detail
+    {
+        template <class Func, class Field>
+        void for_each_field(Func&& f, Field& field)
+        {
+            f(field);
+        }
+
+        template <class Func, class... T>
+        void for_each_field(Func&& f, Field_tuple<T...>& fields)
+        {
+            std::apply(
+                [&](auto&... field)
+                {
+                    (f(field), ...);
+                },
+                fields.elements());
+        }
+
+        template <class Func, class Field, class... Fields>
+        void for_each_field(Func&& f, Field& field, Fields&... fields)
+        {
+            for_each_field(f, field);
+            (for_each_field(f, fields), ...);
+        }
+
+#ifdef SAMURAI_WITH_MPI
+        /**
+         * Cells leaving and entering the subdomain of the current rank.
+         */
+        template <class Mesh>
+        struct migration_plan
+        {
+            using ca_type = typename Mesh::ca_type;
+
+            ca_type kept;
+            std::vector<int> send_ranks;
+            std::vector<ca_type> sent;
+            std::vector<int> recv_ranks;
+            std::vector<ca_type> received;
+            ca_type new_cells;
+        };
+
+        /**
+         * The cells are ordered along a space-filling curve at the finest level,
+         * which is cut into pieces of equal weight. To avoid gathering the keys of
+         * all the cells, each rank only contributes a fixed number of samples of its
+         * own piece of curve: the resulting imbalance is at most of the order of
+         * the weight of a sample.
+         */
+        template <class Mesh, class Weight>
+        auto make_migration_plan(const Mesh& mesh, const Weight& weight)
+        {
+            static constexpr std::size_t dim              = Mesh::dim;
+            static constexpr std::size_t samples_per_rank = 256;
+            using mesh_id_t                               = typename Mesh::mesh_id_t;
+            using value_t                                 = typename Mesh::value_t;
+            using cl_type                                 = typename Mesh::cl_type;
+
+            mpi::communicator world;
+            auto rank = static_cast<std::size_t>(world.rank());
+            auto size = static_cast<std::size_t>(world.size());
+
+            const auto& domain    = mesh.domain();
+            std::size_t ref_level = std::max(mesh.max_level(), domain.level());
+            auto min_corner       = domain.min_indices();
+            auto max_corner       = domain.max_indices();
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                min_corner[d] <<= ref_level - domain.level();
+                max_corner[d] <<= ref_level - domain.level();
+            }
+            auto curve = args::partitioner == MeshPartitioner::Morton ? sfc::Curve::Morton : sfc::Curve::Hilbert;
+            sfc::CurveIndexer<dim, value_t> indexer(curve, ref_level, min_corner, max_corner);
+
+            std::vector<sfc::weighted_key> keys;
+            keys.reserve(mesh.nb_cells(mesh_id_t::cells));
+            for_each_cell(mesh[mesh_id_t::cells],
+                          [&](const auto& cell)
+                          {
+                              keys.push_back({indexer(cell.level, cell.indices), weight(cell)});
+                          });
+
+            auto sorted_keys = keys;
+            std::sort(sorted_keys.begin(),
+                      sorted_keys.end(),
+                      [](const auto& a, const auto& b)
+                      {
+                          return a.key < b.key;
+                      });
+            auto samples = sfc::sample_curve(sorted_keys, samples_per_rank);
+
+            std::vector<sfc::key_type> sample_keys;
+            std::vector<double> sample_weights;
+            sample_keys.reserve(samples.size());
+            sample_weights.reserve(samples.size());
+            for (const auto& s : samples)
+            {
+                sample_keys.push_back(s.key);
+                sample_weights.push_back(s.weight);
+            }
+            std::vector<std::vector<sfc::key_type>> all_sample_keys;
+            std::vector<std::vector<double>> all_sample_weights;
+            mpi::all_gather(world, sample_keys, all_sample_keys);
+            mpi::all_gather(world, sample_weights, all_sample_weights);
+
+            std::vector<sfc::weighted_key> all_samples;
+            for (std::size_t r = 0; r < size; ++r)
+            {
+                for (std::size_t s = 0; s < all_sample_keys[r].size(); ++s)
+                {
+                    all_samples.push_back({all_sample_keys[r][s], all_sample_weights[r][s]});
+                }
+            }
+            auto splitters = sfc::split_curve(all_samples, size);
+
+            // destination of the cells, in the order of the keys
+            std::map<std::size_t, cl_type> destinations;
+            std::size_t k = 0;
+            for_each_interval(mesh[mesh_id_t::cells],
+                              [&](std::size_t level, const auto& i, const auto& index)
+                              {
+                                  for (auto x = i.start; x < i.end; ++x)
+                                  {
+                                      destinations[sfc::part_of(splitters, keys[k++].key)][level][index].add_point(x);
+                                  }
+                              });
+
+            migration_plan<Mesh> plan;
+            std::vector<std::size_t> send_counts(size, 0);
+            for (auto& [dest, cl] : destinations)
+            {
+                if (dest == rank)
+                {
+                    plan.kept = {cl, false};
+                }
+                else
+                {
+                    plan.send_ranks.push_back(static_cast<int>(dest));
+                    plan.sent.emplace_back(cl, false);
+                    send_counts[dest] = plan.sent.back().nb_cells();
+                }
+            }
+
+            std::vector<std::size_t> recv_counts;
+            mpi::all_to_all(world, send_counts, recv_counts);
+            for (std::size_t r = 0; r < size; ++r)
+            {
+                if (recv_counts[r] > 0)
+                {
+                    plan.recv_ranks.push_back(static_cast<int>(r));
+                }
+            }
+            plan.received.resize(plan.recv_ranks.size());
+
+            std::vector<mpi::request> req;
+            for (std::size_t s = 0; s < plan.sent.size(); ++s)
+            {
+                req.push_back(world.isend(plan.send_ranks[s], plan.send_ranks[s], plan.sent[s]));
+            }
+            for (std::size_t r = 0; r < plan.received.size(); ++r)
+            {
+                world.recv(plan.recv_ranks[r], world.rank(), plan.received[r]);
+            }
+            mpi::wait_all(req.begin(), req.end());
+
+            cl_type new_cl(mesh.origin_point(), mesh.scaling_factor());
+            auto add_cells = [&](const auto& ca)
+            {
+                for_each_interval(ca,
+                                  [&](std::size_t level, const auto& i, const auto& index)
+                                  {
+                                      new_cl[level][index].add_interval(i);
+                                  });
+            };
+            add_cells(plan.kept);
+            for (const auto& ca : plan.received)
+            {
+                add_cells(ca);
+            }
+            plan.new_cells = {new_cl, false};
+            return plan;
+        }
+
+        /**
+         * Values of the field in the cells, component by component, in the order of the intervals.
+         */
+        template <class Field, class CellArray>
+        auto gather_values(const Field& field, const CellArray& cells)
+        {
+            using mesh_id_t = typename Field::mesh_t::mesh_id_t;
+            using size_type = typename Field::size_type;
+
+            const auto& reference = field.mesh()[mesh_id_t::reference];
+
+            std::vector<typename Field::value_type> values;
+            values.reserve(cells.nb_cells() * Field::n_comp);
+            for_each_interval(cells,
+                              [&](std::size_t level, const auto& i, const auto& index)
+                              {
+                                  auto offset = reference[level].get_interval(i, index).index;
+                                  for (auto x = i.start; x < i.end; ++x)
+                                  {
+                                      auto cell_index = static_cast<size_type>(offset + x);
+                                      if constexpr (Field::is_scalar)
+                                      {
+                                          values.push_back(field[cell_index]);
+                                      }
+                                      else
+                                      {
+                                          for (size_type c = 0; c < Field::n_comp; ++c)
+                                          {
+                                              values.push_back(field[cell_index][c]);
+                                          }
+                                      }
+                                  }
+                              });
+            return values;
+        }
+
+        /**
+         * Inverse of gather_values.
+         */
+        template <class Field, class CellArray, class Values>
+        void scatter_values(Field& field, const CellArray& cells, const Values& values)
+        {
+            using mesh_id_t = typename Field::mesh_t::mesh_id_t;
+            using size_type = typename Field::size_type;
+
+            const auto& reference = field.mesh()[mesh_id_t::reference];
+
+            std::size_t k = 0;
+            for_each_interval(cells,
+                              [&](std::size_t level, const auto& i, const auto& index)
+                              {
+                                  auto offset = reference[level].get_interval(i, index).index;
+                                  for (auto x = i.start; x < i.end; ++x)
+                                  {
+                                      auto cell_index = static_cast<size_type>(offset + x);
+                                      if constexpr (Field::is_scalar)
+                                      {
+                                          field[cell_index] = values[k++];
+                                      }
+                                      else
+                                      {
+                                          for (size_type c = 0; c < Field::n_comp; ++c)
+                                          {
+                                              field[cell_index][c] = values[k++];
+                                          }
+                                      }
+                                  }
+                              });
+        }
+
+        /**
+         * Sends the values of the leaving cells and receives those of the entering ones.
+         * Returns the function which stores them in the field, once the mesh is repartitioned.
+         */
+        template <class Field, class Plan>
+        std::function<void()> migrate_values(Field& field, const Plan& plan)
+        {
+            using values_t = std::vector<typename Field::value_type>;
+
+            mpi::communicator world;
+            std::vector<mpi::request> req;
+
+            std::vector<values_t> sent_values(plan.sent.size());
+            for (std::size_t s = 0; s < plan.sent.size(); ++s)
+            {
+                sent_values[s] = gather_values(field, plan.sent[s]);
+                req.push_back(world.isend(plan.send_ranks[s], plan.send_ranks[s], sent_values[s]));
+            }
+            std::vector<values_t> received_values(plan.received.size());
+            for (std::size_t r = 0; r < plan.received.size(); ++r)
+            {
+                world.recv(plan.recv_ranks[r], world.rank(), received_values[r]);
+            }
+            mpi::wait_all(req.begin(), req.end());
+
+            return [&field, &plan, kept_values = gather_values(field, plan.kept), received_values = std::move(received_values)]()
+            {
+                field.resize();
+                scatter_values(field, plan.kept, kept_values);
+                for (std::size_t r = 0; r < plan.received.size(); ++r)
+                {
+                    scatter_values(field, plan.received[r], received_values[r]);
+                }
+            };
+        }
+#endif // SAMURAI_WITH_MPI
+    }
+
+    /**
+     * Repartitions the mesh of the fields when the load imbalance exceeds the threshold
+     * (see load_imbalance): the cells are distributed along a space-filling curve
+     * (Morton if --partitioner=morton, Hilbert otherwise) into pieces of equal weight,
+     * and the cell values of the fields migrate with them. The ghosts must be updated
+     * afterwards, as after an adaptation.
+     *
+     * @param weight: cost of a cell, double(const cell_t&) (see uniform_load_weight, level_load_weight)
+     * @param fields: fields or Field_tuple defined on the same mesh
+     * @return true if the mesh has been repartitioned
+     *
+     * Must be called by all the ranks. Without MPI, does nothing.
+     */
+    template <class Weight, class Field, class... Fields>
+    bool load_balancing([[maybe_unused]] double threshold,
+                        [[maybe_unused]] const Weight& weight,
+                        [[maybe_unused]] Field& field,
+                        [[maybe_unused]] Fields&... other_fields)
+    {
+#ifdef SAMURAI_WITH_MPI
+        auto& mesh = field.mesh();
+
+        mpi::communicator world;
+        if (world.size() == 1 || load_imbalance(mesh, weight) <= threshold)
+        {
+            return false;
+        }
+
+        times::timers.start("load balancing");
+        auto plan = detail::make_migration_plan(mesh, weight);
+
+        std::vector<std::function<void()>> store_values;
+        detail::for_each_field(
+            [&](auto& f)
+            {
+                store_values.push_back(detail::migrate_values(f, plan));
+            },
+            field,
+            other_fields...);
+
+        mesh.repartition(plan.new_cells);
+        for (auto& store : store_values)
+        {
+            store();
+        }
+        times::timers.stop("load balancing");
+        return true;
+#else
+        return false;
+#endif
+    }
+}
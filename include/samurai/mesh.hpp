@@ -3,16 +3,24 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <set>
+#include <vector>
 
 #include <fmt/format.h>
 
+#include "arguments.hpp"
 #include "box.hpp"
 #include "cell_array.hpp"
 #include "cell_list.hpp"
+#include "field_workspace.hpp"
+#include "halo_exchange.hpp"
+#include "space_filling_curve.hpp"
 #include "static_algorithm.hpp"
 #include "subset/node.hpp"
+#include "subset_cache.hpp"
 
 #ifdef SAMURAI_WITH_MPI
 #include <boost/serialization/vector.hpp>
@@ -43,6 +51,16 @@ namespace samurai
         }
     };
 
+    namespace detail
+    {
+        /// Returns a new identifier each time it is called, used to version the meshes.
+        inline std::size_t new_mesh_version()
+        {
+            static std::atomic<std::size_t> counter{0};
+            return ++counter;
+        }
+    }
+
     template <class MeshType>
     struct MPI_Subdomain
     {
@@ -84,7 +102,9 @@ namespace samurai
 
         using mesh_t = samurai::MeshIDArray<ca_type, mesh_id_t>;
 
-        using mpi_subdomain_t = MPI_Subdomain<D>;
+        using mpi_subdomain_t      = MPI_Subdomain<D>;
+        using halo_exchange_plan_t = HaloExchangePlan<index_t>;
+        using subset_cache_t       = SubsetCache<dim, interval_t>;
 
         std::size_t nb_cells(mesh_id_t mesh_id = mesh_id_t::reference) const;
         std::size_t nb_cells(std::size_t level, mesh_id_t mesh_id = mesh_id_t::reference) const;
@@ -111,9 +131,15 @@ namespace samurai
         // std::vector<int>& neighbouring_ranks();
         std::vector<mpi_subdomain_t>& mpi_neighbourhood();
         const std::vector<mpi_subdomain_t>& mpi_neighbourhood() const;
+        halo_exchange_plan_t& halo_exchange_plan();
+        FieldWorkspace& field_workspace();
+        subset_cache_t& subset_cache() const;
 
         void swap(Mesh_base& mesh) noexcept;
 
+        std::size_t version() const;
+        CellNumbering numbering() const;
+
         template <typename... T, typename = std::enable_if_t<std::conjunction_v<std::is_convertible<T, value_t>...>, void>>
         const interval_t& get_interval(std::size_t level, const interval_t& interval, T... index) const;
         template <class E>
@@ -139,6 +165,8 @@ namespace samurai
         void update_neighbour_subdomain();
         void update_meshid_neighbour(const mesh_id_t& mesh_id);
 
+        void repartition(const ca_type& ca);
+
         void to_stream(std::ostream& os) const;
 
       protected:
@@ -177,12 +205,11 @@ namespace samurai
         void construct_union();
         void update_sub_mesh();
         void renumbering();
+        void number_leaves_first();
 
         void find_neighbourhood();
 
         void partition_mesh(std::size_t start_level, const Box<double, dim>& global_box);
-        void load_balancing();
-        void load_transfer(const std::vector<double>& load_fluxes);
         std::size_t max_nb_cells(std::size_t level) const;
 
         lca_type m_domain;
@@ -194,6 +221,11 @@ namespace samurai
         ca_type m_union;
         // std::vector<int> m_neighbouring_ranks;
         std::vector<mpi_subdomain_t> m_mpi_neighbourhood;
+        std::size_t m_version = detail::new_mesh_version();
+        CellNumbering m_numbering = CellNumbering::Rows;
+        halo_exchange_plan_t m_halo_exchange_plan;
+        FieldWorkspace m_field_workspace;
+        mutable subset_cache_t m_subset_cache;
 
 #ifdef SAMURAI_WITH_MPI
         friend class boost::serialization::access;
@@ -210,6 +242,7 @@ namespace samurai
             ar & m_union;
             ar & m_min_level;
             ar & m_max_level;
+            ar & m_numbering;
         }
 #endif
     };
@@ -248,7 +281,6 @@ namespace samurai
 
 #ifdef SAMURAI_WITH_MPI
         partition_mesh(start_level, b);
-        // load_balancing();
 #else
         this->m_cells[mesh_id_t::cells][start_level] = {start_level, b, approx_box_tol, scaling_factor_};
 #endif
@@ -279,7 +311,6 @@ namespace samurai
 
 #ifdef SAMURAI_WITH_MPI
         partition_mesh(start_level, b);
-        // load_balancing();
 #else
         this->m_cells[mesh_id_t::cells][start_level] = {start_level, b, approx_box_tol, scaling_factor_};
 #endif
@@ -399,12 +430,26 @@ namespace samurai
     template <class D, class Config>
     inline std::size_t Mesh_base<D, Config>::max_nb_cells(std::size_t level) const
     {
-        if (m_cells[mesh_id_t::reference][level][0].empty())
+        const auto& x_intervals = m_cells[mesh_id_t::reference][level][0];
+        if (x_intervals.empty())
         {
             return 0;
         }
-        auto last_xinterval = m_cells[mesh_id_t::reference][level][0].back();
-        return static_cast<std::size_t>(static_cast<index_t>(last_xinterval.start) + last_xinterval.index) + last_xinterval.size();
+        auto end_of = [](const auto& interval)
+        {
+            return static_cast<std::size_t>(static_cast<index_t>(interval.start) + interval.index) + interval.size();
+        };
+        if (m_numbering == CellNumbering::Rows)
+        {
+            return end_of(x_intervals.back());
+        }
+        // the x-intervals without leaves are stored after the other ones
+        std::size_t end = 0;
+        for (const auto& interval : x_intervals)
+        {
+            end = std::max(end, end_of(interval));
+        }
+        return end;
     }
 
     template <class D, class Config>
@@ -610,6 +655,36 @@ namespace samurai
         return m_mpi_neighbourhood;
     }
 
+    /**
+     * Plan of the ghost exchange with the neighbouring subdomains.
+     * It is (re)built by update_ghost_subdomains when its version differs from the mesh one.
+     */
+    template <class D, class Config>
+    inline auto Mesh_base<D, Config>::halo_exchange_plan() -> halo_exchange_plan_t&
+    {
+        return m_halo_exchange_plan;
+    }
+
+    /**
+     * Pool of field storages recycled by the temporaries of the operators (see WorkspaceField).
+     * It follows the cells when two meshes are swapped.
+     */
+    template <class D, class Config>
+    inline FieldWorkspace& Mesh_base<D, Config>::field_workspace()
+    {
+        return m_field_workspace;
+    }
+
+    /**
+     * Set expressions of the mesh materialized for its current version (see cached_subset).
+     * It is a cache: it can be filled through a const mesh.
+     */
+    template <class D, class Config>
+    inline auto Mesh_base<D, Config>::subset_cache() const -> subset_cache_t&
+    {
+        return m_subset_cache;
+    }
+
     template <class D, class Config>
     inline void Mesh_base<D, Config>::swap(Mesh_base<D, Config>& mesh) noexcept
     {
@@ -621,6 +696,33 @@ namespace samurai
         swap(m_union, mesh.m_union);
         swap(m_max_level, mesh.m_max_level);
         swap(m_min_level, mesh.m_min_level);
+        swap(m_version, mesh.m_version);
+        swap(m_numbering, mesh.m_numbering);
+        swap(m_halo_exchange_plan, mesh.m_halo_exchange_plan);
+        swap(m_field_workspace, mesh.m_field_workspace);
+        swap(m_subset_cache, mesh.m_subset_cache);
+    }
+
+    /**
+     * Identifier of the cell arrays of the mesh: each constructed mesh gets a new one,
+     * and it follows the cells when two meshes are swapped (e.g. after the adaptation).
+     * Data computed from the mesh structure (stencil connectivity, caches...) can
+     * be kept as long as the version is unchanged.
+     */
+    template <class D, class Config>
+    inline std::size_t Mesh_base<D, Config>::version() const
+    {
+        return m_version;
+    }
+
+    /**
+     * Order of the cells in the storage of the fields, given by args::numbering
+     * when the cells were numbered.
+     */
+    template <class D, class Config>
+    inline CellNumbering Mesh_base<D, Config>::numbering() const
+    {
+        return m_numbering;
     }
 
     template <class D, class Config>
@@ -632,7 +734,15 @@ namespace samurai
     template <class D, class Config>
     inline void Mesh_base<D, Config>::renumbering()
     {
-        m_cells[mesh_id_t::reference].update_index();
+        m_numbering = args::numbering;
+        if (m_numbering == CellNumbering::LeavesFirst)
+        {
+            number_leaves_first();
+        }
+        else
+        {
+            m_cells[mesh_id_t::reference].update_index();
+        }
 
         for (std::size_t id = 0; id < static_cast<std::size_t>(mesh_id_t::count); ++id)
         {
@@ -649,6 +759,51 @@ namespace samurai
         }
     }
 
+    /**
+     * Numbers the cells of the reference mesh level by level. In a level, the x-intervals
+     * which contain leaves come first, in the order of the rows, then the x-intervals made
+     * of ghosts only. The x-intervals are kept whole: an interval with leaves also stores
+     * its ghosts in the x direction.
+     */
+    template <class D, class Config>
+    inline void Mesh_base<D, Config>::number_leaves_first()
+    {
+        using coord_index_t = typename interval_t::coord_index_t;
+
+        auto& reference      = m_cells[mesh_id_t::reference];
+        std::size_t acc_size = 0;
+        for (std::size_t level = reference.min_level(); level <= reference.max_level(); ++level)
+        {
+            auto& x_intervals = reference[level][0];
+            std::vector<bool> with_leaves(x_intervals.size(), false);
+
+            find_hint_t<dim> hint{};
+            xt::xtensor_fixed<coord_index_t, xt::xshape<dim>> coord;
+            for_each_interval(m_cells[mesh_id_t::cells][level],
+                              [&](std::size_t, const auto& i, const auto& index)
+                              {
+                                  coord[0] = i.start;
+                                  for (std::size_t d = 0; d < dim - 1; ++d)
+                                  {
+                                      coord[d + 1] = index[d];
+                                  }
+                                  with_leaves[static_cast<std::size_t>(find(reference[level], coord, hint))] = true;
+                              });
+
+            for (bool leaves : {true, false})
+            {
+                for (std::size_t n = 0; n < x_intervals.size(); ++n)
+                {
+                    if (with_leaves[n] == leaves)
+                    {
+                        x_intervals[n].index = safe_subs<index_t>(acc_size, x_intervals[n].start);
+                        acc_size += x_intervals[n].size();
+                    }
+                }
+            }
+        }
+    }
+
     template <class D, class Config>
     inline void Mesh_base<D, Config>::update_mesh_neighbour()
     {
@@ -739,6 +894,36 @@ namespace samurai
 #endif // SAMURAI_WITH_MPI
     }
 
+    /**
+     * Rebuilds the mesh in place on new cells after cells have moved between the
+     * subdomains (see load_balancing): the subdomain, the MPI neighbourhood and all
+     * the derived cell arrays are recomputed, and the mesh gets a new version.
+     * Must be called by all the ranks.
+     */
+    template <class D, class Config>
+    inline void Mesh_base<D, Config>::repartition(const ca_type& ca)
+    {
+        for (std::size_t id = 0; id < mesh_t::size; ++id)
+        {
+            m_cells[id] = {};
+        }
+        m_cells[mesh_id_t::cells] = ca;
+        m_mpi_neighbourhood.clear();
+
+        construct_subdomain();
+        construct_union();
+        update_sub_mesh();
+        renumbering();
+        update_mesh_neighbour();
+
+        set_origin_point(m_domain.origin_point());
+        set_scaling_factor(m_domain.scaling_factor());
+
+        m_version = detail::new_mesh_version();
+        m_field_workspace.clear();
+        m_subset_cache.clear();
+    }
+
     template <class D, class Config>
     inline void Mesh_base<D, Config>::construct_domain()
     {
@@ -886,8 +1071,38 @@ namespace samurai
         std::size_t subdomain_start = 0;
         std::size_t subdomain_end   = 0;
         lcl_type subdomain_cells(start_level, m_domain.origin_point(), m_domain.scaling_factor());
+        if (args::partitioner != MeshPartitioner::Intervals)
+        {
+            // Cut the space-filling curve going through the cells of the domain into pieces of equal number of cells
+            auto curve = args::partitioner == MeshPartitioner::Hilbert ? sfc::Curve::Hilbert : sfc::Curve::Morton;
+            sfc::CurveIndexer<dim, value_t> indexer(curve, start_level, m_domain.min_indices(), m_domain.max_indices());
+
+            std::vector<sfc::weighted_key> keys;
+            keys.reserve(m_domain.nb_cells());
+            for_each_meshinterval(m_domain,
+                                  [&](auto mi)
+                                  {
+                                      for (auto i = mi.i.start; i < mi.i.end; ++i)
+                                      {
+                                          keys.push_back({indexer(mi.level, i, mi.index), 1.});
+                                      }
+                                  });
+            auto splitters = sfc::split_curve(keys, static_cast<std::size_t>(size));
+
+            for_each_meshinterval(m_domain,
+                                  [&](auto mi)
+                                  {
+                                      for (auto i = mi.i.start; i < mi.i.end; ++i)
+                                      {
+                                          if (sfc::part_of(splitters, indexer(mi.level, i, mi.index)) == static_cast<std::size_t>(rank))
+                                          {
+                                              subdomain_cells[mi.index].add_point(i);
+                                          }
+                                      }
+                                  });
+        }
         // in 1D MPI, we need a specific partitioning
-        if (dim == 1)
+        else if (dim == 1)
         {
             std::size_t n_cells               = m_domain.nb_cells();
             std::size_t n_cells_per_subdomain = n_cells / static_cast<std::size_t>(size);
@@ -935,83 +1150,6 @@ namespace samurai
 #endif
     }
 
-    template <class D, class Config>
-    void Mesh_base<D, Config>::load_balancing()
-    {
-#ifdef SAMURAI_WITH_MPI
-        mpi::communicator world;
-        auto rank = world.rank();
-
-        std::size_t load = nb_cells(mesh_id_t::cells);
-        std::vector<std::size_t> loads;
-
-        std::vector<double> load_fluxes(m_mpi_neighbourhood.size(), 0);
-
-        const std::size_t n_iterations = 1;
-
-        for (std::size_t k = 0; k < n_iterations; ++k)
-        {
-            world.barrier();
-            if (rank == 0)
-            {
-                std::cout << "---------------- k = " << k << " ----------------" << std::endl;
-            }
-            mpi::all_gather(world, load, loads);
-
-            std::vector<std::size_t> nb_neighbours;
-            mpi::all_gather(world, m_mpi_neighbourhood.size(), nb_neighbours);
-
-            double load_np1 = static_cast<double>(load);
-            for (std::size_t i_rank = 0; i_rank < m_mpi_neighbourhood.size(); ++i_rank)
-            {
-                auto neighbour = m_mpi_neighbourhood[i_rank];
-
-                auto neighbour_load = loads[static_cast<std::size_t>(neighbour.rank)];
-                int neighbour_load_minus_my_load;
-                if (load < neighbour_load)
-                {
-                    neighbour_load_minus_my_load = static_cast<int>(neighbour_load - load);
-                }
-                else
-                {
-                    neighbour_load_minus_my_load = -static_cast<int>(load - neighbour_load);
-                }
-                double weight       = 1. / std::max(m_mpi_neighbourhood.size(), nb_neighbours[neighbour.rank]);
-                load_fluxes[i_rank] = weight * neighbour_load_minus_my_load;
-                load_np1 += load_fluxes[i_rank];
-            }
-            load_np1 = floor(load_np1);
-
-            load_transfer(load_fluxes);
-
-            std::cout << rank << ": load = " << load << ", load_np1 = " << load_np1 << std::endl;
-
-            load = static_cast<std::size_t>(load_np1);
-        }
-#endif
-    }
-
-    template <class D, class Config>
-    void Mesh_base<D, Config>::load_transfer([[maybe_unused]] const std::vector<double>& load_fluxes)
-    {
-#ifdef SAMURAI_WITH_MPI
-        mpi::communicator world;
-        std::cout << world.rank() << ": ";
-        for (std::size_t i_rank = 0; i_rank < m_mpi_neighbourhood.size(); ++i_rank)
-        {
-            auto neighbour = m_mpi_neighbourhood[i_rank];
-            if (load_fluxes[i_rank] < 0) // must tranfer load to the neighbour
-            {
-            }
-            else if (load_fluxes[i_rank] > 0) // must receive load from the neighbour
-            {
-            }
-            std::cout << "--> " << neighbour.rank << ": " << load_fluxes[i_rank] << ", ";
-        }
-        std::cout << std::endl;
-#endif
-    }
-
     template <class D, class Config>
     inline void Mesh_base<D, Config>::to_stream(std::ostream& os) const
     {
@@ -3,11 +3,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
+
 #include "../algorithm/graduation.hpp"
 #include "../algorithm/update.hpp"
 #include "../arguments.hpp"
 #include "../boundary.hpp"
 #include "../field.hpp"
+#include "../load_balancing.hpp"
+#include "../subset/parallel_apply.hpp"
 #include "../timers.hpp"
 #include "criteria.hpp"
 #include "operators.hpp"
@@ -93,6 +98,9 @@ namespace samurai
         template <class... Fields>
         void operator()(double eps, double regularity, Fields&... other_fields);
 
+        template <class Weight>
+        void set_load_weight(Weight&& weight);
+
       private:
 
         using inner_fields_type = detail::get_fields_type<TField, TFields...>;
@@ -101,6 +109,7 @@ namespace samurai
         using mesh_id_t         = typename mesh_t::mesh_id_t;
         using detail_t          = typename inner_fields_type::detail_t;
         using tag_t             = ScalarField<mesh_t, int>;
+        using cell_t            = typename mesh_t::cell_t;
 
         static constexpr std::size_t dim = mesh_t::dim;
         static constexpr bool enlarge_v  = enlarge_;
@@ -115,6 +124,9 @@ namespace samurai
         fields_t m_fields; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
         detail_t m_detail;
         tag_t m_tag;
+
+        // Cost of a cell used to balance the load after the adaptation (see load_balancing)
+        std::function<double(const cell_t&)> m_load_weight = uniform_load_weight{};
     };
 
     template <bool enlarge_, class TField, class... TFields>
@@ -152,6 +164,24 @@ namespace samurai
             }
         }
         times::timers.stop("mesh adaptation");
+
+#ifdef SAMURAI_WITH_MPI
+        if (args::load_balancing_threshold > 0)
+        {
+            load_balancing(args::load_balancing_threshold, m_load_weight, m_fields, other_fields...);
+        }
+#endif
+    }
+
+    /**
+     * Sets the cost of a cell, double(const cell_t&), used to balance the load
+     * after the adaptation when --load-balancing-threshold is set (uniform by default).
+     */
+    template <bool enlarge_, class TField, class... TFields>
+    template <class Weight>
+    void Adapt<enlarge_, TField, TFields...>::set_load_weight(Weight&& weight)
+    {
+        m_load_weight = std::forward<Weight>(weight);
     }
 
     // TODO: to remove since it is used at several place
@@ -199,7 +229,12 @@ namespace samurai
     {
         // Since the adaptation process starts at max_level, we just need to flag to `keep` the boundary cells at max_level only.
         // There will never be boundary cells at lower levels.
-        auto bdry = domain_boundary_layer(mesh, mesh.max_level(), direction, Mesh::config::max_stencil_width);
+        auto& bdry = cached_subset(mesh,
+                                   {"keep_boundary_refined", mesh.max_level(), std::vector<int>(direction.begin(), direction.end())},
+                                   [&]()
+                                   {
+                                       return domain_boundary_layer(mesh, mesh.max_level(), direction, Mesh::config::max_stencil_width);
+                                   });
         for_each_cell(mesh,
                       bdry,
                       [&](auto& cell)
@@ -234,11 +269,11 @@ namespace samurai
         std::size_t min_level = mesh.min_level();
         std::size_t max_level = mesh.max_level();
 
-        for_each_cell(mesh[mesh_id_t::cells],
-                      [&](auto& cell)
-                      {
-                          m_tag[cell] = static_cast<int>(CellFlag::keep);
-                      });
+        for_each_cell<Run::Parallel>(mesh[mesh_id_t::cells],
+                                     [&](auto& cell)
+                                     {
+                                         m_tag[cell] = static_cast<int>(CellFlag::keep);
+                                     });
 
         for (std::size_t level = min_level; level <= max_level; ++level)
         {
@@ -268,8 +303,8 @@ namespace samurai
         {
             // 1. detail computation in the cells (at level+1)
             auto ghosts_below_cells = intersection(mesh[mesh_id_t::all_cells][level], mesh[mesh_id_t::cells][level + 1]).on(level);
-            ghosts_below_cells.apply_op(compute_detail(m_detail, m_fields)); // 'compute_detail' applies 1 level above the set it is applied
-                                                                             // to, i.e. level+1
+            parallel_apply_op(ghosts_below_cells, compute_detail(m_detail, m_fields)); // 'compute_detail' applies 1 level above the set it
+                                                                                       // is applied to, i.e. level+1
 
             // 2. detail computation in the ghosts below cells (at level)
             if (level >= min_level)
@@ -277,7 +312,7 @@ namespace samurai
                 if (periodic_in_all_directions)
                 {
                     auto ghosts_2_levels_below_cells = intersection(mesh[mesh_id_t::all_cells][level - 1], ghosts_below_cells).on(level - 1);
-                    ghosts_2_levels_below_cells.apply_op(compute_detail(m_detail, m_fields));
+                    parallel_apply_op(ghosts_2_levels_below_cells, compute_detail(m_detail, m_fields));
                 }
                 else
                 {
@@ -293,9 +328,9 @@ namespace samurai
                     auto cells_without_bdry  = intersection(mesh[mesh_id_t::cells][level + 1], domain_without_bdry);
                     auto ghosts_below_cells2 = intersection(mesh[mesh_id_t::all_cells][level], cells_without_bdry).on(level);
                     auto ghosts_2_levels_below_cells = intersection(mesh[mesh_id_t::all_cells][level - 1], ghosts_below_cells2).on(level - 1);
-                    ghosts_2_levels_below_cells.apply_op(compute_detail(m_detail, m_fields)); // 'compute_detail' applies 1 level above the
-                                                                                              // set it is applied to, i.e. 1 level below
-                                                                                              // cells
+                    parallel_apply_op(ghosts_2_levels_below_cells,
+                                      compute_detail(m_detail, m_fields)); // 'compute_detail' applies 1 level above the set it is
+                                                                           // applied to, i.e. 1 level below cells
                 }
             }
         }
@@ -311,7 +346,8 @@ namespace samurai
 
             auto subset_1 = intersection(mesh[mesh_id_t::cells][level], mesh[mesh_id_t::all_cells][level - 1]).on(level - 1);
 
-            subset_1.apply_op(to_coarsen_mr(m_detail, m_tag, eps_l, min_level),
+            parallel_apply_op(subset_1,
+                              to_coarsen_mr(m_detail, m_tag, eps_l, min_level),
                               to_refine_mr(m_detail,
                                            m_tag,
                                            (pow(2.0, regularity_to_use)) * eps_l,
@@ -328,13 +364,14 @@ namespace samurai
         {
             auto subset_2 = intersection(mesh[mesh_id_t::cells][level], mesh[mesh_id_t::cells][level]);
 
-            subset_2.apply_op(keep_around_refine(m_tag));
+            // keep_around_refine and enlarge write in the neighbours of the cells
+            parallel_apply_op<1>(subset_2, keep_around_refine(m_tag));
 
             if constexpr (enlarge_v)
             {
                 auto subset_3 = intersection(mesh[mesh_id_t::cells_and_ghosts][level], mesh[mesh_id_t::cells_and_ghosts][level]);
-                subset_2.apply_op(enlarge(m_tag));
-                subset_3.apply_op(tag_to_keep<0>(m_tag, CellFlag::enlarge));
+                parallel_apply_op<1>(subset_2, enlarge(m_tag));
+                parallel_apply_op(subset_3, tag_to_keep<0>(m_tag, CellFlag::enlarge));
             }
 
             update_tag_periodic(level, m_tag);
@@ -348,7 +385,7 @@ namespace samurai
             update_tag_periodic(level, m_tag);
             update_tag_subdomains(level, m_tag);
 
-            keep_subset.apply_op(maximum(m_tag));
+            parallel_apply_op(keep_subset, maximum(m_tag));
         }
         using ca_type = typename mesh_t::ca_type;
 
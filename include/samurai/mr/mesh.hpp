@@ -69,6 +69,9 @@ namespace samurai
         using cl_type    = typename base_type::cl_type;
         using lcl_type   = typename base_type::lcl_type;
 
+        using flat_cl_type  = typename base_type::ca_type::flat_cl_type;
+        using flat_lcl_type = typename flat_cl_type::lcl_type;
+
         using ca_type  = typename base_type::ca_type;
         using lca_type = typename base_type::lca_type;
 
@@ -149,13 +152,13 @@ namespace samurai
         auto max_level = mpi::all_reduce(world, this->cells()[mesh_id_t::cells].max_level(), mpi::maximum<std::size_t>());
         // cppcheck-suppress redundantInitialization
         auto min_level = mpi::all_reduce(world, this->cells()[mesh_id_t::cells].min_level(), mpi::minimum<std::size_t>());
-        cl_type cell_list;
+        flat_cl_type cell_list;
 #else
         // cppcheck-suppress redundantInitialization
         auto max_level = this->cells()[mesh_id_t::cells].max_level();
         // cppcheck-suppress redundantInitialization
         auto min_level = this->cells()[mesh_id_t::cells].min_level();
-        cl_type cell_list;
+        flat_cl_type cell_list;
 #endif
         // Construction of ghost cells
         // ===========================
@@ -175,7 +178,7 @@ namespace samurai
             this->cells()[mesh_id_t::cells],
             [&](std::size_t level, const auto& interval, const auto& index_yz)
             {
-                lcl_type& lcl = cell_list[level];
+                flat_lcl_type& lcl = cell_list[level];
                 static_nested_loop<dim - 1, -config::max_stencil_width, config::max_stencil_width + 1>(
                     [&](auto stencil)
                     {
@@ -196,7 +199,7 @@ namespace samurai
                 expr(
                     [&](const auto& interval, const auto& index_yz)
                     {
-                        lcl_type& lcl = cell_list[level - 1];
+                        flat_lcl_type& lcl = cell_list[level - 1];
 
                         static_nested_loop<dim - 1, -config::prediction_order, config::prediction_order + 1>(
                             [&](auto stencil)
@@ -214,7 +217,7 @@ namespace samurai
                     {
                         if (level - 1 > 0)
                         {
-                            lcl_type& lcl = cell_list[level - 2];
+                            flat_lcl_type& lcl = cell_list[level - 2];
 
                             static_nested_loop<dim - 1, -config::prediction_order, config::prediction_order + 1>(
                                 [&](auto stencil)
@@ -239,12 +242,12 @@ namespace samurai
                     expr(
                         [&](const auto& interval, const auto& index_yz)
                         {
-                            lcl_type& lcl = cell_list[level];
+                            flat_lcl_type& lcl = cell_list[level];
                             lcl[index_yz].add_interval(interval);
 
                             if (level > neighbour.mesh[mesh_id_t::reference].min_level())
                             {
-                                lcl_type& lclm1 = cell_list[level - 1];
+                                flat_lcl_type& lclm1 = cell_list[level - 1];
 
                                 static_nested_loop<dim - 1, -config::prediction_order, config::prediction_order + 1>(
                                     [&](auto stencil)
@@ -310,7 +313,7 @@ namespace samurai
             for (std::size_t level = 0; level <= this->max_level(); ++level)
             {
                 const std::size_t delta_l = subdomain.level() - level;
-                lcl_type& lcl             = cell_list[level];
+                flat_lcl_type& lcl        = cell_list[level];
 
                 for (std::size_t d = 0; d < dim; ++d)
                 {
@@ -382,8 +385,8 @@ namespace samurai
             }
             for (std::size_t level = 0; level < max_level; ++level)
             {
-                lcl_type& lcl = cell_list[level + 1];
-                lcl_type lcl_proj{level};
+                flat_lcl_type& lcl = cell_list[level + 1];
+                flat_lcl_type lcl_proj{level};
                 auto expr = intersection(this->cells()[mesh_id_t::all_cells][level], this->get_union()[level]);
 
                 expr(
@@ -411,7 +414,7 @@ namespace samurai
                     expr(
                         [&](const auto& interval, const auto& index_yz)
                         {
-                            lcl_type& lcl = cell_list[level];
+                            flat_lcl_type& lcl = cell_list[level];
                             lcl[index_yz].add_interval(interval);
                         });
                     for (std::size_t d = 0; d < dim; ++d)
@@ -424,7 +427,7 @@ namespace samurai
                             expr_left(
                                 [&](const auto& interval, const auto& index_yz)
                                 {
-                                    lcl_type& lcl = cell_list[level];
+                                    flat_lcl_type& lcl = cell_list[level];
                                     lcl[index_yz].add_interval(interval);
                                 });
 
@@ -433,7 +436,7 @@ namespace samurai
                             expr_right(
                                 [&](const auto& interval, const auto& index_yz)
                                 {
-                                    lcl_type& lcl = cell_list[level];
+                                    flat_lcl_type& lcl = cell_list[level];
                                     lcl[index_yz].add_interval(interval);
                                 });
                         }
@@ -251,6 +251,11 @@ namespace samurai
         template <class T1, class T2, std::size_t order = T2::mesh_t::config::prediction_order>
         inline void operator()(Dim<1>, T1& detail, const T2& field) const
         {
+            if (detail::detail_kernel<order>(detail, field, level, i, index))
+            {
+                return;
+            }
+
             if constexpr (order == 0)
             {
                 detail(level + 1, 2 * i)     = field(level + 1, 2 * i) - field(level, i);
@@ -268,6 +273,11 @@ namespace samurai
         template <class T1, class T2, std::size_t order = T2::mesh_t::config::prediction_order>
         inline void operator()(Dim<2>, T1& detail, const T2& field) const
         {
+            if (detail::detail_kernel<order>(detail, field, level, i, index))
+            {
+                return;
+            }
+
             if constexpr (order == 0)
             {
                 detail(level + 1, 2 * i, 2 * j)         = field(level + 1, 2 * i, 2 * j) - field(level, i, j);
@@ -314,6 +324,11 @@ namespace samurai
         template <class T1, class T2, std::size_t order = T2::mesh_t::config::prediction_order>
         inline void operator()(Dim<3>, T1& detail, const T2& field) const
         {
+            if (detail::detail_kernel<order>(detail, field, level, i, index))
+            {
+                return;
+            }
+
             if constexpr (order == 0)
             {
                 detail(level + 1, 2 * i, 2 * j, 2 * k)             = field(level + 1, 2 * i, 2 * j, 2 * k) - field(level, i, j, k);
@@ -434,6 +449,11 @@ namespace samurai
         template <class Ranges, class T1, class T2>
         inline void compute_detail_impl(Dim<dim> d, std::size_t i_r, const Ranges& ranges, T1& detail, const T2& field) const
         {
+            if (detail::detail_kernel<T2::mesh_t::config::prediction_order>(detail, field, level, i, index, ranges[i_r]))
+            {
+                return;
+            }
+
             auto dest_shape = shape(detail(ranges[i_r], ranges[i_r + 1], level + 1, 2 * i, 2 * index));
             auto src_shape  = shape(field(level + 1, 2 * i, 2 * index));
 
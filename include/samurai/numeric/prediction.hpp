@@ -11,6 +11,7 @@
 
 #include "../operators_base.hpp"
 #include "../storage/utils.hpp"
+#include "prediction_kernels.hpp"
 #ifdef SAMURAI_CHECK_NAN
 #include "../io/hdf5.hpp"
 #endif
@@ -403,6 +404,11 @@ namespace samurai
                                                           std::integral_constant<std::size_t, 0>,
                                                           std::integral_constant<bool, true>) const
     {
+        if (detail::prediction_kernel<0, true>(dest, src, level, i, index))
+        {
+            return;
+        }
+
         auto ii = i << 1;
         ii.step = 2;
 
@@ -418,6 +424,11 @@ namespace samurai
                                                           std::integral_constant<std::size_t, 0>,
                                                           std::integral_constant<bool, false>) const
     {
+        if (detail::prediction_kernel<0, false>(dest, src, level, i, index))
+        {
+            return;
+        }
+
         auto even_i = i.even_elements();
         if (even_i.is_valid())
         {
@@ -441,6 +452,11 @@ namespace samurai
                                                           std::integral_constant<std::size_t, order>,
                                                           std::integral_constant<bool, true>) const
     {
+        if (detail::prediction_kernel<order, true>(dest, src, level, i, index))
+        {
+            return;
+        }
+
         auto ii = i << 1;
         ii.step = 2;
 
@@ -458,6 +474,11 @@ namespace samurai
                                                           std::integral_constant<std::size_t, order>,
                                                           std::integral_constant<bool, false>) const
     {
+        if (detail::prediction_kernel<order, false>(dest, src, level, i, index))
+        {
+            return;
+        }
+
         auto qs_i = Qs_i<order>(src, level - 1, i >> 1);
 
         auto even_i = i.even_elements();
@@ -485,6 +506,11 @@ namespace samurai
                                                           std::integral_constant<std::size_t, 0>,
                                                           std::integral_constant<bool, true>) const
     {
+        if (detail::prediction_kernel<0, true>(dest, src, level, i, index))
+        {
+            return;
+        }
+
         auto ii = i << 1;
         ii.step = 2;
 
@@ -504,6 +530,11 @@ namespace samurai
                                                           std::integral_constant<std::size_t, 0>,
                                                           std::integral_constant<bool, false>) const
     {
+        if (detail::prediction_kernel<0, false>(dest, src, level, i, index))
+        {
+            return;
+        }
+
         if (j & 1)
         {
             auto even_i = i.even_elements();
@@ -546,6 +577,11 @@ namespace samurai
                                                           std::integral_constant<std::size_t, order>,
                                                           std::integral_constant<bool, true>) const
     {
+        if (detail::prediction_kernel<order, true>(dest, src, level, i, index))
+        {
+            return;
+        }
+
         auto ii = i << 1;
         ii.step = 2;
 
@@ -569,6 +605,11 @@ namespace samurai
                                                           std::integral_constant<std::size_t, order>,
                                                           std::integral_constant<bool, false>) const
     {
+        if (detail::prediction_kernel<order, false>(dest, src, level, i, index))
+        {
+            return;
+        }
+
         auto qs_i  = Qs_i<order>(src, level - 1, i >> 1, j >> 1);
         auto qs_j  = Qs_j<order>(src, level - 1, i >> 1, j >> 1);
         auto qs_ij = Qs_ij<order>(src, level - 1, i >> 1, j >> 1);
@@ -632,6 +673,11 @@ namespace samurai
                                                           std::integral_constant<std::size_t, 0>,
                                                           std::integral_constant<bool, true>) const
     {
+        if (detail::prediction_kernel<0, true>(dest, src, level, i, index))
+        {
+            return;
+        }
+
         auto ii = i << 1;
         ii.step = 2;
 
@@ -656,6 +702,11 @@ namespace samurai
                                                           std::integral_constant<std::size_t, 0>,
                                                           std::integral_constant<bool, false>) const
     {
+        if (detail::prediction_kernel<0, false>(dest, src, level, i, index))
+        {
+            return;
+        }
+
         auto even_i = i.even_elements();
         if (even_i.is_valid())
         {
@@ -679,6 +730,11 @@ namespace samurai
                                                           std::integral_constant<std::size_t, order>,
                                                           std::integral_constant<bool, true>) const
     {
+        if (detail::prediction_kernel<order, true>(dest, src, level, i, index))
+        {
+            return;
+        }
+
         auto ii = i << 1;
         ii.step = 2;
 
@@ -711,6 +767,11 @@ namespace samurai
                                                           std::integral_constant<std::size_t, order>,
                                                           std::integral_constant<bool, false>) const
     {
+        if (detail::prediction_kernel<order, false>(dest, src, level, i, index))
+        {
+            return;
+        }
+
         auto qs_i   = Qs_i<order>(src, level - 1, i >> 1, j >> 1, k >> 1);
         auto qs_j   = Qs_j<order>(src, level - 1, i >> 1, j >> 1, k >> 1);
         auto qs_k   = Qs_k<order>(src, level - 1, i >> 1, j >> 1, k >> 1);
@@ -0,0 +1,594 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include <xtensor/xfixed.hpp>
+
+#include "../algorithm.hpp"
+#include "../arguments.hpp"
+#include "../utils.hpp"
+
+namespace samurai
+{
+    template <std::size_t s>
+    inline std::array<double, s> prediction_coeffs();
+
+    /**
+     * Vectorized kernels of the prediction operator and of the details.
+     *
+     * The generic implementation (prediction_op, compute_detail_op) evaluates xtensor
+     * expressions over strided views, one for each shifted interval of the stencil.
+     * The kernels below work on raw pointers to the rows of the stencil: each coarse cell
+     * gives its 2 children in x in the same loop iteration, so that the fine values are
+     * written (and read for the details) as interleaved even/odd pairs, and the loops
+     * are vectorized by the compiler.
+     *
+     * They compute the same terms as Qs_i, Qs_j, Qs_ij, ...: the results agree with the
+     * generic implementation up to rounding, the compiler being free to contract or
+     * reorder the operations differently in the two implementations.
+     * They return false when they cannot be applied (a row of the stencil is not stored
+     * contiguously, non-unit step, ...): the caller then uses the generic implementation.
+     * They can be disabled with the option --disable-mr-kernels.
+     */
+    namespace detail
+    {
+        /**
+         * Raw access to the rows of a field: the component c of the cell of storage index n
+         * is data[c * component_stride + n * cell_stride].
+         */
+        template <class Field>
+        class raw_rows
+        {
+          public:
+
+            using field_t    = std::remove_const_t<Field>;
+            using mesh_t     = typename field_t::mesh_t;
+            using mesh_id_t  = typename mesh_t::mesh_id_t;
+            using interval_t = typename mesh_t::interval_t;
+            using value_t    = typename interval_t::value_t;
+            using pointer    = std::conditional_t<std::is_const_v<Field>, const typename field_t::value_type*, typename field_t::value_type*>;
+
+            static constexpr std::size_t dim            = field_t::dim;
+            static constexpr std::size_t n_comp         = field_t::n_comp;
+            static constexpr std::ptrdiff_t cell_stride = (n_comp == 1 || detail::is_soa_v<field_t>) ? 1 : static_cast<std::ptrdiff_t>(n_comp);
+
+            explicit raw_rows(Field& field, std::size_t first_component = 0)
+                : m_mesh(&field.mesh())
+                , m_data(field.array().data())
+            {
+                if constexpr (detail::is_soa_v<field_t> && n_comp > 1)
+                {
+                    m_component_stride = static_cast<std::ptrdiff_t>(field.array().size()) / static_cast<std::ptrdiff_t>(n_comp);
+                }
+                else
+                {
+                    m_component_stride = 1;
+                }
+                m_data += static_cast<std::ptrdiff_t>(first_component) * m_component_stride;
+            }
+
+            /**
+             * Pointer to the cell `start` of the row (level, index) of the component 0,
+             * nullptr if the cells [start, end) of the row are not stored contiguously.
+             */
+            template <class Index>
+            pointer row(std::size_t level, value_t start, value_t end, const Index& index)
+            {
+                const auto& lca = (*m_mesh)[mesh_id_t::reference][level];
+                xt::xtensor_fixed<value_t, xt::xshape<dim>> coord;
+                coord[0] = start;
+                for (std::size_t d = 1; d < dim; ++d)
+                {
+                    coord[d] = index[d - 1];
+                }
+                auto offset = find(lca, coord, m_hint);
+                if (offset < 0)
+                {
+                    return nullptr;
+                }
+                const auto& interval = lca[0][static_cast<std::size_t>(offset)];
+                if (interval.end < end)
+                {
+                    return nullptr;
+                }
+                return m_data + static_cast<std::ptrdiff_t>(interval.index + start) * cell_stride;
+            }
+
+            pointer component(pointer row_ptr, std::size_t c) const
+            {
+                return row_ptr + static_cast<std::ptrdiff_t>(c) * m_component_stride;
+            }
+
+          private:
+
+            const mesh_t* m_mesh;
+            pointer m_data;
+            std::ptrdiff_t m_component_stride = 1;
+            find_hint_t<dim> m_hint{};
+        };
+
+        template <class T>
+        inline constexpr bool has_raw_rows_v = []()
+        {
+#ifdef SAMURAI_CHECK_NAN
+            return false;
+#else
+            if constexpr (is_field_type_v<T>)
+            {
+                return std::is_floating_point_v<typename std::decay_t<T>::value_type> && std::decay_t<T>::dim <= 3;
+            }
+            else
+            {
+                return false;
+            }
+#endif
+        }();
+
+        template <class Field>
+        inline auto make_raw_rows(Field& field, std::size_t first_component = 0)
+        {
+            return raw_rows<Field>(field, first_component);
+        }
+
+        /**
+         * Values of the coarse cells around a row: u(ii, dx, dy, dz) is the value of the cell
+         * (cs + ii + dx, j + dy, k + dz), (cs, j, k) being the first cell of the row.
+         */
+        template <std::size_t dim, std::size_t order, class pointer, std::ptrdiff_t stride>
+        struct coarse_stencil
+        {
+            static constexpr std::size_t width = 2 * order + 1;
+            static constexpr std::size_t ny    = dim > 1 ? width : 1;
+            static constexpr std::size_t nz    = dim > 2 ? width : 1;
+            static constexpr auto sy           = static_cast<std::ptrdiff_t>(dim > 1 ? order : 0);
+            static constexpr auto sz           = static_cast<std::ptrdiff_t>(dim > 2 ? order : 0);
+
+            std::array<pointer, ny * nz> rows;
+
+            inline auto operator()(std::ptrdiff_t ii, std::ptrdiff_t dx, std::ptrdiff_t dy, std::ptrdiff_t dz) const
+            {
+                return rows[static_cast<std::size_t>((dy + sy) * static_cast<std::ptrdiff_t>(nz) + dz + sz)][(ii + dx) * stride];
+            }
+        };
+
+        /**
+         * Builds the coarse stencil of the component 0 of the row (level, [cs, ce), index):
+         * returns false if one of its rows is not stored contiguously.
+         */
+        template <std::size_t dim, std::size_t order, class Rows, class Stencil, class value_t, class Index>
+        inline bool gather_coarse_stencil(Rows& src, Stencil& stencil, std::size_t level, value_t cs, value_t ce, const Index& index)
+        {
+            static constexpr auto s = static_cast<value_t>(order);
+
+            std::array<value_t, dim - 1> row_index;
+            for (std::size_t r = 0; r < stencil.rows.size(); ++r)
+            {
+                if constexpr (dim > 1)
+                {
+                    row_index[0] = static_cast<value_t>(index[0] + static_cast<value_t>(r / Stencil::nz) - static_cast<value_t>(Stencil::sy));
+                }
+                if constexpr (dim > 2)
+                {
+                    row_index[1] = static_cast<value_t>(index[1] + static_cast<value_t>(r % Stencil::nz) - static_cast<value_t>(Stencil::sz));
+                }
+                auto* row_ptr = src.row(level, cs - s, ce + s, row_index);
+                if (row_ptr == nullptr)
+                {
+                    return false;
+                }
+                stencil.rows[r] = row_ptr + static_cast<std::ptrdiff_t>(order) * Rows::cell_stride;
+            }
+            return true;
+        }
+
+        template <class Stencil, class Rows>
+        inline Stencil component_stencil(const Stencil& stencil, const Rows& rows, std::size_t c)
+        {
+            Stencil result;
+            for (std::size_t r = 0; r < stencil.rows.size(); ++r)
+            {
+                result.rows[r] = rows.component(stencil.rows[r], c);
+            }
+            return result;
+        }
+
+        /// index of the first term of the sum nested in the term s (see Qs_i_impl)
+        template <std::size_t s, std::size_t order>
+        inline constexpr std::size_t nested_first = s < order ? s + 1 : order;
+
+        /**
+         * c[s - 1] * (f(s) - f(-s)) + (c[s] * (f(s + 1) - f(-s - 1)) + (...)), as computed by Qs_i_impl:
+         * f also receives the index of the term, which gives the first term of the nested sums.
+         */
+        template <std::size_t s, std::size_t order, class F>
+        inline auto qs_sum(const std::array<double, order>& c, const F& f)
+        {
+            constexpr auto offset = static_cast<std::ptrdiff_t>(s);
+            auto term = c[s - 1] * (f(std::integral_constant<std::size_t, s>{}, offset) - f(std::integral_constant<std::size_t, s>{}, -offset));
+            if constexpr (s == order)
+            {
+                return term;
+            }
+            else
+            {
+                return term + qs_sum<s + 1>(c, f);
+            }
+        }
+
+        /**
+         * Terms of the prediction of the coarse cell ii: q[0] is its value and q[m], m > 0,
+         * the term Qs of the directions of the bits of m (q[1] = Qs_i, q[2] = Qs_j, q[3] = Qs_ij, ...).
+         */
+        template <std::size_t dim, std::size_t order, class Stencil>
+        inline auto prediction_terms(const Stencil& u, const std::array<double, order>& c, std::ptrdiff_t ii)
+        {
+            using term_t = decltype(1. * u(0, 0, 0, 0));
+
+            std::array<term_t, (1 << dim)> q{};
+            q[0] = u(ii, 0, 0, 0);
+            if constexpr (order > 0)
+            {
+                q[1] = qs_sum<1>(c,
+                                 [&](auto, std::ptrdiff_t dx)
+                                 {
+                                     return u(ii, dx, 0, 0);
+                                 });
+                if constexpr (dim > 1)
+                {
+                    q[2] = qs_sum<1>(c,
+                                     [&](auto, std::ptrdiff_t dy)
+                                     {
+                                         return u(ii, 0, dy, 0);
+                                     });
+                    q[3] = qs_sum<1>(c,
+                                     [&](auto sx, std::ptrdiff_t dx)
+                                     {
+                                         return qs_sum<nested_first<decltype(sx)::value, order>>(c,
+                                                                                                 [&](auto, std::ptrdiff_t dy)
+                                                                                                 {
+                                                                                                     return u(ii, dx, dy, 0);
+                                                                                                 });
+                                     });
+                }
+                if constexpr (dim > 2)
+                {
+                    q[4] = qs_sum<1>(c,
+                                     [&](auto, std::ptrdiff_t dz)
+                                     {
+                                         return u(ii, 0, 0, dz);
+                                     });
+                    q[5] = qs_sum<1>(c,
+                                     [&](auto sx, std::ptrdiff_t dx)
+                                     {
+                                         return qs_sum<nested_first<decltype(sx)::value, order>>(c,
+                                                                                                 [&](auto, std::ptrdiff_t dz)
+                                                                                                 {
+                                                                                                     return u(ii, dx, 0, dz);
+                                                                                                 });
+                                     });
+                    q[6] = qs_sum<1>(c,
+                                     [&](auto sy, std::ptrdiff_t dy)
+                                     {
+                                         return qs_sum<nested_first<decltype(sy)::value, order>>(c,
+                                                                                                 [&](auto, std::ptrdiff_t dz)
+                                                                                                 {
+                                                                                                     return u(ii, 0, dy, dz);
+                                                                                                 });
+                                     });
+                    q[7] = qs_sum<1>(c,
+                                     [&](auto sx, std::ptrdiff_t dx)
+                                     {
+                                         return qs_sum<nested_first<decltype(sx)::value, order>>(
+                                             c,
+                                             [&](auto sy, std::ptrdiff_t dy)
+                                             {
+                                                 return qs_sum<nested_first<decltype(sy)::value, order>>(c,
+                                                                                                         [&](auto, std::ptrdiff_t dz)
+                                                                                                         {
+                                                                                                             return u(ii, dx, dy, dz);
+                                                                                                         });
+                                             });
+                                     });
+                }
+            }
+            return q;
+        }
+
+        /**
+         * Predicted value of the child of sign (sx, sy, sz): the sign is +1 for an even child, -1 for an odd one.
+         */
+        template <std::size_t dim, std::size_t order, class Q>
+        inline auto child_value(const Q& q, double sx, double sy, double sz)
+        {
+            if constexpr (order == 0)
+            {
+                return q[0];
+            }
+            else if constexpr (dim == 1)
+            {
+                return q[0] + sx * q[1];
+            }
+            else if constexpr (dim == 2)
+            {
+                return q[0] + sx * q[1] + sy * q[2] - sx * sy * q[3];
+            }
+            else
+            {
+                return q[0] + sx * q[1] + sy * q[2] + sz * q[4] - sx * sy * q[3] - sx * sz * q[5] - sy * sz * q[6] + sx * sy * sz * q[7];
+            }
+        }
+
+        template <std::size_t order>
+        inline auto kernel_prediction_coeffs()
+        {
+            if constexpr (order == 0)
+            {
+                return std::array<double, 0>{};
+            }
+            else
+            {
+                return prediction_coeffs<order>();
+            }
+        }
+
+        /**
+         * Number of coarse cells processed at once: the values of their children are first
+         * computed in buffers on the stack, which cannot alias the rows of the stencil.
+         */
+        inline constexpr std::ptrdiff_t kernel_block_size = 64;
+
+        /**
+         * Predicted values of the children (even: sx = 1, odd: sx = -1) of the coarse cells
+         * [first, first + n) of the stencil, for the children rows r (b = r & 1, e = r >> 1).
+         */
+        template <std::size_t dim, std::size_t order, std::size_t n_rows, class Stencil, class T>
+        inline void predict_block(const Stencil& u,
+                                  const std::array<double, order>& c,
+                                  std::ptrdiff_t first,
+                                  std::ptrdiff_t n,
+                                  const std::array<std::size_t, n_rows>& rows,
+                                  T (&even)[n_rows][kernel_block_size],
+                                  T (&odd)[n_rows][kernel_block_size])
+        {
+            for (std::ptrdiff_t ii = 0; ii < n; ++ii)
+            {
+                const auto q = prediction_terms<dim, order>(u, c, first + ii);
+                for (std::size_t r = 0; r < n_rows; ++r)
+                {
+                    const double sy = (rows[r] & 1) ? -1. : 1.;
+                    const double sz = (rows[r] & 2) ? -1. : 1.;
+                    even[r][ii]     = child_value<dim, order>(q, 1., sy, sz);
+                    odd[r][ii]      = child_value<dim, order>(q, -1., sy, sz);
+                }
+            }
+        }
+
+        /**
+         * Writes the 2^dim children of the coarse cells (level, i, index) at level + 1:
+         *  - dest = prediction if fine is nullptr;
+         *  - dest = fine - prediction otherwise (details).
+         */
+        template <std::size_t order, class DestRows, class SrcRows, class FineRows, class interval_t, class Index>
+        bool children_kernel(DestRows& dest, SrcRows& src, FineRows* fine, std::size_t level, const interval_t& i, const Index& index)
+        {
+            static constexpr std::size_t dim        = SrcRows::dim;
+            static constexpr std::size_t n_children = 1 << (dim - 1);
+            using value_t                           = typename interval_t::value_t;
+            using term_t                            = std::remove_const_t<std::remove_pointer_t<typename SrcRows::pointer>>;
+            using stencil_t = coarse_stencil<dim, order, typename SrcRows::pointer, SrcRows::cell_stride>;
+
+            if (args::disable_mr_kernels || i.step != 1 || i.is_empty())
+            {
+                return false;
+            }
+
+            stencil_t stencil;
+            if (!gather_coarse_stencil<dim, order>(src, stencil, level, i.start, i.end, index))
+            {
+                return false;
+            }
+
+            // fine rows of the children (., b, e), r = b + 2 * e
+            std::array<std::size_t, n_children> rows;
+            std::array<typename DestRows::pointer, n_children> dest_rows;
+            std::array<typename FineRows::pointer, n_children> fine_rows{};
+            std::array<value_t, dim - 1> fine_index;
+            for (std::size_t r = 0; r < n_children; ++r)
+            {
+                rows[r] = r;
+                for (std::size_t d = 1; d < dim; ++d)
+                {
+                    fine_index[d - 1] = static_cast<value_t>(2 * index[d - 1] + static_cast<value_t>((r >> (d - 1)) & 1));
+                }
+                dest_rows[r] = dest.row(level + 1, 2 * i.start, 2 * i.end, fine_index);
+                if (dest_rows[r] == nullptr)
+                {
+                    return false;
+                }
+                if (fine != nullptr)
+                {
+                    fine_rows[r] = fine->row(level + 1, 2 * i.start, 2 * i.end, fine_index);
+                    if (fine_rows[r] == nullptr)
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            const auto c      = kernel_prediction_coeffs<order>();
+            const auto n      = static_cast<std::ptrdiff_t>(i.size());
+            constexpr auto ds = DestRows::cell_stride;
+            constexpr auto fs = FineRows::cell_stride;
+
+            term_t even[n_children][kernel_block_size];
+            term_t odd[n_children][kernel_block_size];
+
+            for (std::size_t comp = 0; comp < SrcRows::n_comp; ++comp)
+            {
+                const auto u = component_stencil(stencil, src, comp);
+                for (std::ptrdiff_t first = 0; first < n; first += kernel_block_size)
+                {
+                    const auto nb = std::min(kernel_block_size, n - first);
+                    predict_block<dim, order>(u, c, first, nb, rows, even, odd);
+
+                    for (std::size_t r = 0; r < n_children; ++r)
+                    {
+                        auto* out = dest.component(dest_rows[r], comp) + 2 * first * ds;
+                        if (fine == nullptr)
+                        {
+                            for (std::ptrdiff_t ii = 0; ii < nb; ++ii)
+                            {
+                                out[2 * ii * ds]       = even[r][ii];
+                                out[(2 * ii + 1) * ds] = odd[r][ii];
+                            }
+                        }
+                        else
+                        {
+                            const auto* in = fine->component(fine_rows[r], comp) + 2 * first * fs;
+                            for (std::ptrdiff_t ii = 0; ii < nb; ++ii)
+                            {
+                                out[2 * ii * ds]       = in[2 * ii * fs] - even[r][ii];
+                                out[(2 * ii + 1) * ds] = in[(2 * ii + 1) * fs] - odd[r][ii];
+                            }
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Writes the prediction of the cells (level, i, index) from level - 1.
+         */
+        template <std::size_t order, class DestRows, class SrcRows, class interval_t, class Index>
+        bool on_level_kernel(DestRows& dest, SrcRows& src, std::size_t level, const interval_t& i, const Index& index)
+        {
+            static constexpr std::size_t dim = SrcRows::dim;
+            using value_t                    = typename interval_t::value_t;
+            using term_t                     = std::remove_const_t<std::remove_pointer_t<typename SrcRows::pointer>>;
+            using stencil_t                  = coarse_stencil<dim, order, typename SrcRows::pointer, SrcRows::cell_stride>;
+
+            if (args::disable_mr_kernels || i.step != 1 || i.is_empty() || level == 0)
+            {
+                return false;
+            }
+
+            // i is covered by the children of the coarse cells [cs, ce)
+            const value_t cs = i.start >> 1;
+            const value_t ce = ((i.end - 1) >> 1) + 1;
+            std::array<value_t, dim - 1> coarse_index;
+            for (std::size_t d = 1; d < dim; ++d)
+            {
+                coarse_index[d - 1] = static_cast<value_t>(index[d - 1] >> 1);
+            }
+
+            stencil_t stencil;
+            if (!gather_coarse_stencil<dim, order>(src, stencil, level - 1, cs, ce, coarse_index))
+            {
+                return false;
+            }
+            auto* dest_row = dest.row(level, i.start, i.end, index);
+            if (dest_row == nullptr)
+            {
+                return false;
+            }
+
+            std::array<std::size_t, 1> rows{0};
+            for (std::size_t d = 1; d < dim; ++d)
+            {
+                rows[0] |= static_cast<std::size_t>(index[d - 1] & 1) << (d - 1);
+            }
+
+            const auto c      = kernel_prediction_coeffs<order>();
+            const auto n      = static_cast<std::ptrdiff_t>(ce - cs);
+            constexpr auto ds = DestRows::cell_stride;
+            // position in dest_row of the even child of the coarse cell cs
+            const auto shift = static_cast<std::ptrdiff_t>(2 * cs - i.start);
+            // the first (last) coarse cell may only have its odd (even) child in i
+            const bool odd_only  = i.start & 1;
+            const bool even_only = i.end & 1;
+
+            term_t even[1][kernel_block_size];
+            term_t odd[1][kernel_block_size];
+
+            for (std::size_t comp = 0; comp < SrcRows::n_comp; ++comp)
+            {
+                const auto u = component_stencil(stencil, src, comp);
+                auto* out    = dest.component(dest_row, comp);
+                for (std::ptrdiff_t first = 0; first < n; first += kernel_block_size)
+                {
+                    const auto nb = std::min(kernel_block_size, n - first);
+                    predict_block<dim, order>(u, c, first, nb, rows, even, odd);
+
+                    const std::ptrdiff_t begin = (first == 0 && odd_only) ? 1 : 0;
+                    const std::ptrdiff_t end   = (first + nb == n && even_only) ? nb - 1 : nb;
+                    const auto pos             = shift + 2 * first;
+                    if (begin == 1)
+                    {
+                        out[(pos + 1) * ds] = odd[0][0];
+                    }
+                    for (std::ptrdiff_t ii = begin; ii < end; ++ii)
+                    {
+                        out[(pos + 2 * ii) * ds]     = even[0][ii];
+                        out[(pos + 2 * ii + 1) * ds] = odd[0][ii];
+                    }
+                    if (end < nb)
+                    {
+                        out[(pos + 2 * end) * ds] = even[0][end];
+                    }
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Prediction of the cells of the operator (see prediction_op):
+         *  - dest_on_level = true: children at level + 1 of the cells (level, i, index);
+         *  - dest_on_level = false: cells (level, i, index), from level - 1.
+         */
+        template <std::size_t order, bool dest_on_level, class Dest, class Src, class interval_t, class Index>
+        bool prediction_kernel(Dest& dest, const Src& src, std::size_t level, const interval_t& i, const Index& index)
+        {
+            if constexpr (has_raw_rows_v<Dest> && has_raw_rows_v<Src>)
+            {
+                if constexpr (Dest::n_comp == Src::n_comp)
+                {
+                    auto dest_rows = make_raw_rows(dest);
+                    auto src_rows  = make_raw_rows(src);
+                    if constexpr (dest_on_level)
+                    {
+                        return children_kernel<order>(dest_rows, src_rows, static_cast<decltype(src_rows)*>(nullptr), level, i, index);
+                    }
+                    else
+                    {
+                        return on_level_kernel<order>(dest_rows, src_rows, level, i, index);
+                    }
+                }
+            }
+            return false;
+        }
+
+        /**
+         * Details at level + 1 of the children of the cells (level, i, index) (see compute_detail_op).
+         * The components of the field go into the components [first_component, first_component + n_comp) of detail.
+         */
+        template <std::size_t order, class Detail, class Field, class interval_t, class Index>
+        bool detail_kernel(Detail& detail, const Field& field, std::size_t level, const interval_t& i, const Index& index, std::size_t first_component = 0)
+        {
+            if constexpr (has_raw_rows_v<Detail> && has_raw_rows_v<Field>)
+            {
+                assert(first_component + Field::n_comp <= Detail::n_comp);
+                auto detail_rows = make_raw_rows(detail, first_component);
+                auto field_rows  = make_raw_rows(field);
+                return children_kernel<order>(detail_rows, field_rows, &field_rows, level, i, index);
+            }
+            return false;
+        }
+    }
+}
@@ -66,6 +66,9 @@ namespace samurai
             using recursion_t           = std::map<index_t, CellLinearCombination>;
             recursion_t m_ghost_recursion;
 
+            // Coefficients of the row being assembled, inserted at once
+            MatrixRow m_row_buffer;
+
           public:
 
             explicit FVSchemeAssembly(const Scheme& scheme)
@@ -191,6 +194,11 @@ namespace samurai
                 return unknown().mesh();
             }
 
+            void update_numbering() override
+            {
+                this->m_numbering.update(unknown());
+            }
+
             PetscInt matrix_rows() const override
             {
                 return static_cast<PetscInt>(m_n_cells * output_n_comp);
@@ -450,27 +458,24 @@ namespace samurai
                 {
                     auto eq                    = equations[e];
                     const auto& equation_ghost = cells[eq.ghost_index];
-                    for (std::size_t c = 0; c < bdry_stencil_size; ++c)
+                    for (unsigned int field_i = 0; field_i < output_n_comp; ++field_i)
                     {
-                        for (unsigned int field_i = 0; field_i < output_n_comp; ++field_i)
+                        PetscInt equation_row = col_index(equation_ghost, field_i);
+                        m_row_buffer.reset(equation_row);
+                        for (std::size_t c = 0; c < bdry_stencil_size; ++c)
                         {
-                            PetscInt equation_row = col_index(equation_ghost, field_i);
-                            PetscInt col          = col_index(cells[c], field_i);
-
                             double coeff = scheme().bdry_cell_coeff(eq.stencil_coeffs, c, field_i, field_i);
 
                             if (coeff != 0)
                             {
-                                if constexpr (dirichlet_enfcmt == DirichletEnforcement::Elimination)
+                                if constexpr (dirichlet_enfcmt != DirichletEnforcement::Elimination)
                                 {
-                                }
-                                else
-                                {
-                                    MatSetValue(A, equation_row, col, coeff, INSERT_VALUES);
+                                    m_row_buffer.add(col_index(cells[c], field_i), coeff);
                                 }
                                 set_is_row_not_empty(equation_row);
                             }
                         }
+                        m_row_buffer.insert(A, INSERT_VALUES);
                     }
                 }
             }
@@ -622,11 +627,10 @@ namespace samurai
                 {
                     if (m_is_row_empty[i])
                     {
-                        auto error = MatSetValue(A,
-                                                 m_row_shift + static_cast<PetscInt>(i),
-                                                 m_col_shift + static_cast<PetscInt>(i),
-                                                 this->diag_value_for_useless_ghosts(),
-                                                 INSERT_VALUES);
+                        PetscInt row      = m_row_shift + static_cast<PetscInt>(i);
+                        PetscInt col      = m_col_shift + static_cast<PetscInt>(i);
+                        PetscScalar value = this->diag_value_for_useless_ghosts();
+                        auto error        = set_values(A, 1, &row, 1, &col, &value, INSERT_VALUES);
                         if (error)
                         {
                             std::cerr << scheme().name() << ": failure to insert diagonal coefficient at ("
@@ -766,21 +770,19 @@ namespace samurai
                             for (unsigned int field_i = 0; field_i < output_n_comp; ++field_i)
                             {
                                 PetscInt ghost_index = row_index(ghost, field_i);
-                                MatSetValue(A, ghost_index, ghost_index, scaling, current_insert_mode());
+                                m_row_buffer.reset(ghost_index);
+                                m_row_buffer.add(ghost_index, scaling);
                                 for (unsigned int i = 0; i < number_of_children; ++i)
                                 {
-                                    auto error = MatSetValue(A,
-                                                             ghost_index,
-                                                             col_index(children[i], field_i),
-                                                             -scaling / number_of_children,
-                                                             current_insert_mode());
-                                    if (error)
-                                    {
-                                        std::cerr << scheme().name() << ": failure to insert projection coefficient at (" << ghost_index
-                                                  << ", " << m_col_shift + col_index(children[i], field_i) << ")." << std::endl;
-                                        assert(false);
-                                        exit(EXIT_FAILURE);
-                                    }
+                                    m_row_buffer.add(col_index(children[i], field_i), -scaling / number_of_children);
+                                }
+                                auto error = m_row_buffer.insert(A, current_insert_mode());
+                                if (error)
+                                {
+                                    std::cerr << scheme().name() << ": failure to insert the projection coefficients of the row "
+                                              << ghost_index << "." << std::endl;
+                                    assert(false);
+                                    exit(EXIT_FAILURE);
                                 }
                                 set_is_row_not_empty(ghost_index);
                             }
@@ -845,7 +847,8 @@ namespace samurai
                         for (unsigned int field_i = 0; field_i < n_comp; ++field_i)
                         {
                             PetscInt ghost_index = this->row_index(ghost, field_i);
-                            MatSetValue(A, ghost_index, ghost_index, scaling, current_insert_mode());
+                            m_row_buffer.reset(ghost_index);
+                            m_row_buffer.add(ghost_index, scaling);
 
                             auto ii      = ghost.indices(0);
                             auto ig      = ii >> 1;
@@ -854,7 +857,7 @@ namespace samurai
                             auto interpx = samurai::interp_coeffs<2 * prediction_order + 1>(isign);
 
                             auto parent_index = this->col_index(static_cast<PetscInt>(this->mesh().get_index(ghost.level - 1, ig)), field_i);
-                            MatSetValue(A, ghost_index, parent_index, -scaling, current_insert_mode());
+                            m_row_buffer.add(parent_index, -scaling);
 
                             for (std::size_t ci = 0; ci < interpx.size(); ++ci)
                             {
@@ -865,9 +868,10 @@ namespace samurai
                                         static_cast<PetscInt>(
                                             this->mesh().get_index(ghost.level - 1, ig + static_cast<coord_index_t>(ci - prediction_order))),
                                         field_i);
-                                    MatSetValue(A, ghost_index, coarse_cell_index, scaling * value, current_insert_mode());
+                                    m_row_buffer.add(coarse_cell_index, scaling * value);
                                 }
                             }
+                            m_row_buffer.insert(A, current_insert_mode());
                             set_is_row_not_empty(ghost_index);
                         }
                     });
@@ -910,7 +914,8 @@ namespace samurai
                         for (unsigned int field_i = 0; field_i < n_comp; ++field_i)
                         {
                             PetscInt ghost_index = this->row_index(ghost, field_i);
-                            MatSetValue(A, ghost_index, ghost_index, scaling, current_insert_mode());
+                            m_row_buffer.reset(ghost_index);
+                            m_row_buffer.add(ghost_index, scaling);
 
                             auto ii      = ghost.indices(0);
                             auto ig      = ii >> 1;
@@ -924,7 +929,7 @@ namespace samurai
 
                             auto parent_index = this->col_index(static_cast<PetscInt>(this->mesh().get_index(ghost.level - 1, ig, jg)),
                                                                 field_i);
-                            MatSetValue(A, ghost_index, parent_index, -scaling, current_insert_mode());
+                            m_row_buffer.add(parent_index, -scaling);
 
                             for (std::size_t ci = 0; ci < interpx.size(); ++ci)
                             {
@@ -938,10 +943,11 @@ namespace samurai
                                                                                      ig + static_cast<coord_index_t>(ci - prediction_order),
                                                                                      jg + static_cast<coord_index_t>(cj - prediction_order))),
                                                                                  field_i);
-                                        MatSetValue(A, ghost_index, coarse_cell_index, scaling * value, current_insert_mode());
+                                        m_row_buffer.add(coarse_cell_index, scaling * value);
                                     }
                                 }
                             }
+                            m_row_buffer.insert(A, current_insert_mode());
                             set_is_row_not_empty(ghost_index);
                         }
                     });
@@ -992,7 +998,8 @@ namespace samurai
                         for (unsigned int field_i = 0; field_i < n_comp; ++field_i)
                         {
                             PetscInt ghost_index = this->row_index(ghost, field_i);
-                            MatSetValue(A, ghost_index, ghost_index, scaling, current_insert_mode());
+                            m_row_buffer.reset(ghost_index);
+                            m_row_buffer.add(ghost_index, scaling);
 
                             auto ii      = ghost.indices(0);
                             auto ig      = ii >> 1;
@@ -1010,7 +1017,7 @@ namespace samurai
 
                             auto parent_index = this->col_index(static_cast<PetscInt>(this->mesh().get_index(ghost.level - 1, ig, jg, kg)),
                                                                 field_i);
-                            MatSetValue(A, ghost_index, parent_index, -scaling, current_insert_mode());
+                            m_row_buffer.add(parent_index, -scaling);
 
                             for (std::size_t ci = 0; ci < interpx.size(); ++ci)
                             {
@@ -1028,11 +1035,12 @@ namespace samurai
                                                                            jg + static_cast<coord_index_t>(cj - prediction_order),
                                                                            kg + static_cast<coord_index_t>(ck - prediction_order))),
                                                 field_i);
-                                            MatSetValue(A, ghost_index, coarse_cell_index, scaling * value, current_insert_mode());
+                                            m_row_buffer.add(coarse_cell_index, scaling * value);
                                         }
                                     }
                                 }
                             }
+                            m_row_buffer.insert(A, current_insert_mode());
                             set_is_row_not_empty(ghost_index);
                         }
                     });
@@ -233,61 +233,25 @@ namespace samurai
                             for (unsigned int field_i = 0; field_i < output_n_comp; ++field_i)
                             {
                                 auto stencil_center_row = static_cast<PetscInt>(row_index(cells[cfg_t::center_index], field_i));
+                                auto& row               = this->m_row_buffer;
+                                row.reset(stencil_center_row);
                                 for (unsigned int field_j = 0; field_j < n_comp; ++field_j)
                                 {
-                                    if constexpr (cfg_t::contiguous_indices_start > 0)
+                                    for (unsigned int c = 0; c < cfg_t::stencil_size; ++c)
                                     {
-                                        for (unsigned int c = 0; c < cfg_t::contiguous_indices_start; ++c)
+                                        double coeff = scheme().cell_coeff(coeffs, c, field_i, field_j);
+                                        // the contiguous coefficients are always inserted
+                                        bool contiguous = c >= cfg_t::contiguous_indices_start
+                                                       && c < cfg_t::contiguous_indices_start + cfg_t::contiguous_indices_size;
+                                        if (contiguous || coeff != 0 || stencil_center_row == cols[local_col_index(c, field_j)])
                                         {
-                                            double coeff = scheme().cell_coeff(coeffs, c, field_i, field_j);
-                                            if (coeff != 0 || stencil_center_row == cols[local_col_index(c, field_j)])
-                                            {
-                                                MatSetValue(A, stencil_center_row, cols[local_col_index(c, field_j)], coeff, ADD_VALUES);
-                                            }
+                                            row.add(cols[local_col_index(c, field_j)], coeff);
                                         }
                                     }
-                                    if constexpr (cfg_t::contiguous_indices_size > 0)
-                                    {
-                                        std::array<double, cfg_t::contiguous_indices_size> contiguous_coeffs;
-                                        for (unsigned int c = 0; c < cfg_t::contiguous_indices_size; ++c)
-                                        {
-                                            contiguous_coeffs[c] = scheme().cell_coeff(coeffs,
-                                                                                       cfg_t::contiguous_indices_start + c,
-                                                                                       field_i,
-                                                                                       field_j);
-                                        }
-                                        // if (std::any_of(contiguous_coeffs.begin(),
-                                        //                 contiguous_coeffs.end(),
-                                        //                 [](auto coeff)
-                                        //                 {
-                                        //                     return coeff != 0;
-                                        //                 }))
-                                        // {
-                                        MatSetValues(A,
-                                                     1,
-                                                     &stencil_center_row,
-                                                     static_cast<PetscInt>(cfg_t::contiguous_indices_size),
-                                                     &cols[local_col_index(cfg_t::contiguous_indices_start, field_j)],
-                                                     contiguous_coeffs.data(),
-                                                     ADD_VALUES);
-                                        // }
-                                    }
-                                    if constexpr (cfg_t::contiguous_indices_start + cfg_t::contiguous_indices_size < cfg_t::stencil_size)
-                                    {
-                                        for (unsigned int c = cfg_t::contiguous_indices_start + cfg_t::contiguous_indices_size;
-                                             c < cfg_t::stencil_size;
-                                             ++c)
-                                        {
-                                            double coeff = scheme().cell_coeff(coeffs, c, field_i, field_j);
-                                            if (coeff != 0 || stencil_center_row == cols[local_col_index(c, field_j)])
-                                            {
-                                                MatSetValue(A, stencil_center_row, cols[local_col_index(c, field_j)], coeff, ADD_VALUES);
-                                            }
-                                        }
-                                    }
-
-                                    set_is_row_not_empty(stencil_center_row);
                                 }
+                                // all the coefficients of the row are inserted at once
+                                row.insert(A, ADD_VALUES);
+                                set_is_row_not_empty(stencil_center_row);
                             }
                         }
                         else // AOS
@@ -305,13 +269,13 @@ namespace samurai
                                 // - in 'rows', for each cell, <output_n_comp> rows are contiguous.
                                 // - in 'cols', for each cell, <n_comp> cols are contiguous.
                                 // - coeffs[c] is a row-major matrix (xtensor), as requested by PETSc.
-                                MatSetValues(A,
-                                             static_cast<PetscInt>(output_n_comp),
-                                             &rows[local_row_index(cfg_t::center_index, 0)],
-                                             static_cast<PetscInt>(n_comp),
-                                             &cols[local_col_index(c, 0)],
-                                             coeffs[c].data(),
-                                             ADD_VALUES);
+                                set_values(A,
+                                           static_cast<PetscInt>(output_n_comp),
+                                           &rows[local_row_index(cfg_t::center_index, 0)],
+                                           static_cast<PetscInt>(n_comp),
+                                           &cols[local_col_index(c, 0)],
+                                           coeffs[c].data(),
+                                           ADD_VALUES);
                             }
 
                             for (unsigned int field_i = 0; field_i < output_n_comp; ++field_i)
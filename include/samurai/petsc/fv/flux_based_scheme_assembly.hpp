@@ -41,6 +41,10 @@ namespace samurai
 
             bool m_include_boundary_fluxes = true;
 
+            // Coefficients of the rows of the two cells of an interface, inserted at once
+            MatrixRow m_left_cell_row;
+            MatrixRow m_right_cell_row;
+
           public:
 
             explicit Assembly(const Scheme& s)
@@ -153,6 +157,8 @@ namespace samurai
                         {
                             auto left_cell_row  = this->row_index(interface_cells[0], field_i);
                             auto right_cell_row = this->row_index(interface_cells[1], field_i);
+                            m_left_cell_row.reset(left_cell_row);
+                            m_right_cell_row.reset(right_cell_row);
                             for (unsigned int field_j = 0; field_j < n_comp; ++field_j)
                             {
                                 for (std::size_t c = 0; c < stencil_size; ++c)
@@ -166,8 +172,8 @@ namespace samurai
                                         if (it_ghost == this->m_ghost_recursion.end())
                                         {
                                             auto comput_cell_col = col_index(comput_cells[c], field_j);
-                                            MatSetValue(A, left_cell_row, comput_cell_col, left_cell_coeff, ADD_VALUES);
-                                            MatSetValue(A, right_cell_row, comput_cell_col, right_cell_coeff, ADD_VALUES);
+                                            m_left_cell_row.add(comput_cell_col, left_cell_coeff);
+                                            m_right_cell_row.add(comput_cell_col, right_cell_coeff);
                                         }
                                         else
                                         {
@@ -175,19 +181,21 @@ namespace samurai
                                             for (auto& [cell, coeff] : linear_comb)
                                             {
                                                 auto comput_cell_col = col_index(static_cast<PetscInt>(cell), field_j);
-                                                MatSetValue(A, left_cell_row, comput_cell_col, left_cell_coeff * coeff, ADD_VALUES);
-                                                MatSetValue(A, right_cell_row, comput_cell_col, right_cell_coeff * coeff, ADD_VALUES);
+                                                m_left_cell_row.add(comput_cell_col, left_cell_coeff * coeff);
+                                                m_right_cell_row.add(comput_cell_col, right_cell_coeff * coeff);
                                             }
                                         }
                                     }
                                     else
                                     {
                                         auto comput_cell_col = col_index(comput_cells[c], field_j);
-                                        MatSetValue(A, left_cell_row, comput_cell_col, left_cell_coeff, ADD_VALUES);
-                                        MatSetValue(A, right_cell_row, comput_cell_col, right_cell_coeff, ADD_VALUES);
+                                        m_left_cell_row.add(comput_cell_col, left_cell_coeff);
+                                        m_right_cell_row.add(comput_cell_col, right_cell_coeff);
                                     }
                                 }
                             }
+                            m_left_cell_row.insert(A, ADD_VALUES);
+                            m_right_cell_row.insert(A, ADD_VALUES);
                             set_is_row_not_empty(left_cell_row);
                             set_is_row_not_empty(right_cell_row);
                         }
@@ -203,15 +211,16 @@ namespace samurai
                             for (unsigned int field_i = 0; field_i < output_n_comp; ++field_i)
                             {
                                 auto cell_row = this->row_index(cell, field_i);
+                                m_left_cell_row.reset(cell_row);
                                 for (unsigned int field_j = 0; field_j < n_comp; ++field_j)
                                 {
                                     for (std::size_t c = 0; c < stencil_size; ++c)
                                     {
-                                        double coeff         = scheme().cell_coeff(coeffs, c, field_i, field_j);
-                                        auto comput_cell_col = col_index(comput_cells[c], field_j);
-                                        MatSetValue(A, cell_row, comput_cell_col, coeff, ADD_VALUES);
+                                        double coeff = scheme().cell_coeff(coeffs, c, field_i, field_j);
+                                        m_left_cell_row.add(col_index(comput_cells[c], field_j), coeff);
                                     }
                                 }
+                                m_left_cell_row.insert(A, ADD_VALUES);
                                 set_is_row_not_empty(cell_row);
                             }
                         });
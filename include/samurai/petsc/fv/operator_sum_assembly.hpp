@@ -58,6 +58,11 @@ namespace samurai
                 return !unknown_ptr();
             }
 
+            void update_numbering() override
+            {
+                this->m_numbering.update(unknown());
+            }
+
             void set_unknown(field_t& unknown)
             {
                 for_each(m_assembly_ops,
@@ -0,0 +1,293 @@
+#pragma once
+#include "../algorithm/update.hpp"
+#include "../field.hpp"
+#include <algorithm>
+#include <petsc.h>
+#include <vector>
+
+namespace samurai
+{
+    namespace petsc
+    {
+        /**
+         * Communicator of the solvers of a single operator: all the processes with MPI.
+         */
+        inline MPI_Comm solver_communicator()
+        {
+#ifdef SAMURAI_WITH_MPI
+            return PETSC_COMM_WORLD;
+#else
+            return PETSC_COMM_SELF;
+#endif
+        }
+
+        /**
+         * Numbering of the unknowns of a field across the MPI processes.
+         *
+         * The local unknowns are the entries of the field storage (cells and ghosts of the subdomain).
+         * The cells whose values are received from a neighbouring subdomain by the ghost exchange are owned
+         * by the neighbour: their equations are assembled by the neighbour, and they only appear here as
+         * columns, with the global numbers of the neighbour. All the other entries are owned by the process,
+         * which numbers them after those of the lower ranks.
+         *
+         * The local rows and columns are mapped to the global ones by PETSc (MatSetValuesLocal): the rows of
+         * the entries not owned are mapped to -1, so that their coefficients are dropped. With a single
+         * process, the numbering is not distributed and the solvers work on the local numbering.
+         *
+         * Only the solvers of a single operator use it: the block solvers (e.g. for the Stokes system) and the
+         * matrix-free solver run on a single process.
+         */
+        class GlobalNumbering
+        {
+          public:
+
+            GlobalNumbering() = default;
+
+            GlobalNumbering(const GlobalNumbering& other)
+            {
+                *this = other;
+            }
+
+            GlobalNumbering& operator=(const GlobalNumbering& other)
+            {
+                if (this != &other)
+                {
+                    destroy();
+                    m_mesh_version  = other.m_mesh_version;
+                    m_owned_size    = other.m_owned_size;
+                    m_global_size   = other.m_global_size;
+                    m_owned_entries = other.m_owned_entries;
+                    m_row_mapping   = other.m_row_mapping;
+                    m_col_mapping   = other.m_col_mapping;
+                    if (m_row_mapping)
+                    {
+                        PetscObjectReference(reinterpret_cast<PetscObject>(m_row_mapping));
+                        PetscObjectReference(reinterpret_cast<PetscObject>(m_col_mapping));
+                    }
+                }
+                return *this;
+            }
+
+            ~GlobalNumbering()
+            {
+                destroy();
+            }
+
+            bool is_distributed() const
+            {
+                return m_row_mapping != nullptr;
+            }
+
+            /// Number of unknowns owned by the process
+            PetscInt owned_size() const
+            {
+                return m_owned_size;
+            }
+
+            PetscInt global_size() const
+            {
+                return m_global_size;
+            }
+
+            ISLocalToGlobalMapping row_mapping() const
+            {
+                return m_row_mapping;
+            }
+
+            ISLocalToGlobalMapping col_mapping() const
+            {
+                return m_col_mapping;
+            }
+
+            /**
+             * Builds the numbering of the unknowns of the field if its mesh has changed.
+             * Collective: all the processes must call it.
+             */
+            template <class Field>
+            void update([[maybe_unused]] Field& field)
+            {
+#ifdef SAMURAI_WITH_MPI
+                mpi::communicator world;
+                auto& mesh = field.mesh();
+                if (world.size() == 1 || (is_distributed() && m_mesh_version == mesh.version()))
+                {
+                    return;
+                }
+                destroy();
+
+                static constexpr std::size_t n_comp = Field::n_comp;
+                const auto n_cells                  = mesh.nb_cells();
+
+                // The cells received by the ghost exchange are owned by the neighbours
+                std::vector<bool> owned(n_cells, true);
+                const auto& plan = samurai::detail::get_halo_exchange_plan(mesh);
+                for (const auto& neighbour : plan.neighbours)
+                {
+                    for (std::size_t level = 0; level + 1 < neighbour.recv.level_offsets.size(); ++level)
+                    {
+                        neighbour.recv.for_each_range(level,
+                                                      true,
+                                                      [&](const auto& range)
+                                                      {
+                                                          for (auto k = range.offset; k < range.offset + range.length; ++k)
+                                                          {
+                                                              owned[static_cast<std::size_t>(k)] = false;
+                                                          }
+                                                      });
+                    }
+                }
+
+                auto n_owned_cells  = static_cast<PetscInt>(std::count(owned.begin(), owned.end(), true));
+                PetscInt first_cell = 0;
+                MPI_Exscan(&n_owned_cells, &first_cell, 1, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD);
+                if (world.rank() == 0)
+                {
+                    first_cell = 0;
+                }
+                MPI_Allreduce(&n_owned_cells, &m_global_size, 1, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD);
+                m_owned_size = n_owned_cells * static_cast<PetscInt>(n_comp);
+                m_global_size *= static_cast<PetscInt>(n_comp);
+
+                // Global numbers of the cells: those of the owned cells are sent to the neighbours.
+                // The second exchange relays the numbers of the outer corners received from a third subdomain.
+                auto numbers    = make_scalar_field<double>("global_numbers", mesh, -1.);
+                PetscInt number = first_cell;
+                for (std::size_t k = 0; k < n_cells; ++k)
+                {
+                    if (owned[k])
+                    {
+                        numbers.array().data()[k] = static_cast<double>(number++);
+                    }
+                }
+                update_ghost_subdomains(numbers);
+                update_ghost_subdomains(numbers);
+
+                // Local entry of the component c of the cell k, in the layout of the field
+                auto local_entry = [&](std::size_t k, std::size_t c)
+                {
+                    if constexpr (samurai::detail::is_soa_v<Field>)
+                    {
+                        return c * n_cells + k;
+                    }
+                    else
+                    {
+                        return k * n_comp + c;
+                    }
+                };
+
+                std::vector<PetscInt> rows(n_cells * n_comp);
+                std::vector<PetscInt> cols(n_cells * n_comp);
+                m_owned_entries.clear();
+                m_owned_entries.reserve(static_cast<std::size_t>(m_owned_size));
+                for (std::size_t k = 0; k < n_cells; ++k)
+                {
+                    auto cell_number = static_cast<PetscInt>(numbers.array().data()[k]);
+                    for (std::size_t c = 0; c < n_comp; ++c)
+                    {
+                        auto entry  = local_entry(k, c);
+                        cols[entry] = cell_number < 0 ? -1 : cell_number * static_cast<PetscInt>(n_comp) + static_cast<PetscInt>(c);
+                        rows[entry] = owned[k] ? cols[entry] : -1;
+                        if (owned[k])
+                        {
+                            m_owned_entries.push_back(static_cast<PetscInt>(entry));
+                        }
+                    }
+                }
+
+                auto n = static_cast<PetscInt>(rows.size());
+                ISLocalToGlobalMappingCreate(PETSC_COMM_WORLD, 1, n, rows.data(), PETSC_COPY_VALUES, &m_row_mapping);
+                ISLocalToGlobalMappingCreate(PETSC_COMM_WORLD, 1, n, cols.data(), PETSC_COPY_VALUES, &m_col_mapping);
+                m_mesh_version = mesh.version();
+#endif
+            }
+
+            /**
+             * Distributed vector of the unknowns owned by the process.
+             */
+            Vec create_vector() const
+            {
+                Vec v;
+                VecCreateMPI(PETSC_COMM_WORLD, m_owned_size, m_global_size, &v);
+                return v;
+            }
+
+            /**
+             * Copies the owned entries of the local vector (field storage) into the distributed vector.
+             */
+            void to_global(const Vec& local, Vec& global) const
+            {
+                const PetscScalar* local_data;
+                PetscScalar* global_data;
+                VecGetArrayRead(local, &local_data);
+                VecGetArray(global, &global_data);
+                for (std::size_t r = 0; r < m_owned_entries.size(); ++r)
+                {
+                    global_data[r] = local_data[m_owned_entries[r]];
+                }
+                VecRestoreArray(global, &global_data);
+                VecRestoreArrayRead(local, &local_data);
+            }
+
+            /**
+             * Copies the distributed vector into the owned entries of the local vector (field storage).
+             * The other entries must then be received from the neighbours (update_ghost_subdomains).
+             */
+            void to_local(const Vec& global, Vec& local) const
+            {
+                const PetscScalar* global_data;
+                PetscScalar* local_data;
+                VecGetArrayRead(global, &global_data);
+                VecGetArray(local, &local_data);
+                for (std::size_t r = 0; r < m_owned_entries.size(); ++r)
+                {
+                    local_data[m_owned_entries[r]] = global_data[r];
+                }
+                VecRestoreArray(local, &local_data);
+                VecRestoreArrayRead(global, &global_data);
+            }
+
+          private:
+
+            void destroy()
+            {
+                if (m_row_mapping)
+                {
+                    ISLocalToGlobalMappingDestroy(&m_row_mapping);
+                    ISLocalToGlobalMappingDestroy(&m_col_mapping);
+                    m_row_mapping = nullptr;
+                    m_col_mapping = nullptr;
+                }
+            }
+
+            std::size_t m_mesh_version = 0;
+            PetscInt m_owned_size      = 0;
+            PetscInt m_global_size     = 0;
+            std::vector<PetscInt> m_owned_entries; ///< local entries of the owned unknowns, in the order of their global numbers
+            ISLocalToGlobalMapping m_row_mapping = nullptr;
+            ISLocalToGlobalMapping m_col_mapping = nullptr;
+        };
+
+        /**
+         * MatSetValues with the local numbering of the rows and columns if the matrix is distributed.
+         */
+        inline PetscErrorCode set_values(Mat& A,
+                                         PetscInt m,
+                                         const PetscInt rows[],
+                                         PetscInt n,
+                                         const PetscInt cols[],
+                                         const PetscScalar values[],
+                                         InsertMode mode)
+        {
+#ifdef SAMURAI_WITH_MPI
+            ISLocalToGlobalMapping row_mapping = nullptr;
+            MatGetLocalToGlobalMapping(A, &row_mapping, nullptr);
+            if (row_mapping)
+            {
+                return MatSetValuesLocal(A, m, rows, n, cols, values, mode);
+            }
+#endif
+            return MatSetValues(A, m, rows, n, cols, values, mode);
+        }
+
+    } // end namespace petsc
+} // end namespace samurai
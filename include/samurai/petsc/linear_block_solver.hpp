@@ -103,6 +103,14 @@ namespace samurai
 
             void setup() override
             {
+#ifdef SAMURAI_WITH_MPI
+                if (mpi::communicator().size() > 1)
+                {
+                    std::cerr << "The block solvers are not distributed: they run on a single MPI process." << std::endl;
+                    assert(false && "Distributed block solver");
+                    exit(EXIT_FAILURE);
+                }
+#endif
                 if constexpr (is_monolithic)
                 {
                     base_class::setup();
@@ -127,7 +135,8 @@ namespace samurai
                 // KSPSetUp(m_ksp); // PETSc fails at KSPSolve() for some reason.
                 times::timers.stop("solver setup");
 
-                m_is_set_up = true;
+                m_is_set_up          = true;
+                this->m_mesh_version = this->mesh_version();
             }
 
             template <class... Fields>
@@ -138,6 +147,7 @@ namespace samurai
                 //                   "The number of source fields passed to solve() must equal "
                 //                   "the number of rows of the block operator.");
 
+                this->reset_if_mesh_changed();
                 if (!m_is_set_up)
                 {
                     setup();
@@ -9,11 +9,18 @@
 #else
 #include "utils.hpp"
 #endif
+#include <algorithm>
 
 namespace samurai
 {
     namespace petsc
     {
+        /**
+         * The matrix and the setup of the solver (preconditioner, ...) are kept from one call of solve()
+         * to the next as long as the mesh of the unknowns is unchanged: the solver is set up again once
+         * the mesh has been adapted. If the coefficients of the scheme change on the same mesh,
+         * reassemble_matrix() fills the existing matrix again, without a new allocation.
+         */
         template <class Assembly>
         class LinearSolverBase
         {
@@ -22,9 +29,10 @@ namespace samurai
           protected:
 
             Assembly m_assembly;
-            KSP m_ksp        = nullptr;
-            Mat m_A          = nullptr;
-            bool m_is_set_up = false;
+            KSP m_ksp                  = nullptr;
+            Mat m_A                    = nullptr;
+            bool m_is_set_up           = false;
+            std::size_t m_mesh_version = 0; ///< version of the mesh the solver is set up for
 
           public:
 
@@ -67,10 +75,11 @@ namespace samurai
                 if (this != &other)
                 {
                     this->destroy_petsc_objects();
-                    this->m_assembly  = other.m_assembly;
-                    this->m_ksp       = other.m_ksp;
-                    this->m_A         = other.m_A;
-                    this->m_is_set_up = other.m_is_set_up;
+                    this->m_assembly     = other.m_assembly;
+                    this->m_ksp          = other.m_ksp;
+                    this->m_A            = other.m_A;
+                    this->m_is_set_up    = other.m_is_set_up;
+                    this->m_mesh_version = other.m_mesh_version;
                 }
                 return *this;
             }
@@ -80,13 +89,14 @@ namespace samurai
                 if (this != &other)
                 {
                     this->destroy_petsc_objects();
-                    this->m_assembly  = other.m_assembly;
-                    this->m_ksp       = other.m_ksp;
-                    this->m_A         = other.m_A;
-                    this->m_is_set_up = other.m_is_set_up;
-                    other.m_ksp       = nullptr; // Prevent KSP destruction when 'other' object is destroyed
-                    other.m_A         = nullptr;
-                    other.m_is_set_up = false;
+                    this->m_assembly     = other.m_assembly;
+                    this->m_ksp          = other.m_ksp;
+                    this->m_A            = other.m_A;
+                    this->m_is_set_up    = other.m_is_set_up;
+                    this->m_mesh_version = other.m_mesh_version;
+                    other.m_ksp          = nullptr; // Prevent KSP destruction when 'other' object is destroyed
+                    other.m_A            = nullptr;
+                    other.m_is_set_up    = false;
                 }
                 return *this;
             }
@@ -116,6 +126,33 @@ namespace samurai
 
           protected:
 
+            /**
+             * Version of the mesh of the unknown(s) (the largest one for a block assembly), 0 if the unknowns are not set.
+             */
+            std::size_t mesh_version() const
+            {
+                std::size_t version = 0;
+                if constexpr (requires { m_assembly.unknown_ptr(); })
+                {
+                    if (m_assembly.unknown_ptr())
+                    {
+                        version = m_assembly.unknown_ptr()->mesh().version();
+                    }
+                }
+                else
+                {
+                    m_assembly.for_each_assembly_op(
+                        [&](auto& op, auto, auto)
+                        {
+                            if (op.unknown_ptr())
+                            {
+                                version = std::max(version, op.unknown_ptr()->mesh().version());
+                            }
+                        });
+                }
+                return version;
+            }
+
             virtual void configure_solver()
             {
                 _configure_solver();
@@ -165,11 +202,44 @@ namespace samurai
                     assert(false && "Failed solver setup");
                     exit(EXIT_FAILURE);
                 }
-                m_is_set_up = true;
+                m_is_set_up    = true;
+                m_mesh_version = mesh_version();
+            }
+
+            /**
+             * Assembles the matrix again in the existing one, whose nonzero structure is kept.
+             * The solver is set up from scratch if the mesh has changed.
+             */
+            virtual void reassemble_matrix()
+            {
+                if (m_A == nullptr || !is_set_up() || mesh_version() != m_mesh_version)
+                {
+                    reset();
+                    setup();
+                    return;
+                }
+
+                MatZeroEntries(m_A);
+                assembly().reset();
+                assembly().assemble_matrix(m_A);
+                // Same nonzero structure: the next KSPSolve() only updates the numerical setup
+                // of the preconditioner, its symbolic setup (factorization pattern, ...) is reused.
+                KSPSetOperators(m_ksp, m_A, m_A);
             }
 
           protected:
 
+            /**
+             * Resets the solver if it has been set up for another version of the mesh.
+             */
+            void reset_if_mesh_changed()
+            {
+                if (is_set_up() && mesh_version() != m_mesh_version)
+                {
+                    reset();
+                }
+            }
+
             void prepare_rhs_and_solve(Vec& b, Vec& x)
             {
                 times::timers.start("system solve");
@@ -192,7 +262,23 @@ namespace samurai
                 times::timers.start("system solve");
 
                 // Solve the system
-                KSPSolve(m_ksp, b, x);
+                if (is_distributed())
+                {
+                    // b and x are stored as the fields: only their owned entries are unknowns of the distributed system
+                    const auto& numbering = m_assembly.numbering();
+                    Vec b_global          = numbering.create_vector();
+                    Vec x_global          = numbering.create_vector();
+                    numbering.to_global(b, b_global);
+                    numbering.to_global(x, x_global);
+                    KSPSolve(m_ksp, b_global, x_global);
+                    numbering.to_local(x_global, x);
+                    VecDestroy(&b_global);
+                    VecDestroy(&x_global);
+                }
+                else
+                {
+                    KSPSolve(m_ksp, b, x);
+                }
 
                 times::timers.stop("system solve");
 
@@ -213,6 +299,21 @@ namespace samurai
                 // VecView(x, PETSC_VIEWER_STDOUT_(PETSC_COMM_SELF)); std::cout << std::endl;
             }
 
+            /**
+             * True if the system is distributed across the MPI processes (see GlobalNumbering).
+             */
+            bool is_distributed() const
+            {
+                if constexpr (requires { m_assembly.numbering(); })
+                {
+                    return m_assembly.numbering().is_distributed();
+                }
+                else
+                {
+                    return false;
+                }
+            }
+
           public:
 
             int iterations()
@@ -282,7 +383,7 @@ namespace samurai
 #endif
                 KSPDestroy(&user_ksp);
 
-                KSPCreate(PETSC_COMM_SELF, &m_ksp);
+                KSPCreate(solver_communicator(), &m_ksp);
                 KSPSetFromOptions(m_ksp);
 #ifdef ENABLE_MG
                 if (m_use_samurai_mg)
@@ -344,11 +445,13 @@ namespace samurai
                 times::timers.start("solver setup");
                 KSPSetUp(m_ksp);
                 times::timers.stop("solver setup");
-                m_is_set_up = true;
+                m_is_set_up          = true;
+                this->m_mesh_version = this->mesh_version();
             }
 
             void solve(const Field& rhs)
             {
+                this->reset_if_mesh_changed();
                 if (!m_is_set_up)
                 {
                     setup();
@@ -360,6 +463,12 @@ namespace samurai
 
                 VecDestroy(&b);
                 VecDestroy(&x);
+
+                if (this->is_distributed())
+                {
+                    // values of the entries owned by the neighbours
+                    update_ghost_subdomains(assembly().unknown());
+                }
             }
 
             void solve(Field& unknown, const Field& rhs)
@@ -1,11 +1,65 @@
 #pragma once
 #include "../timers.hpp"
+#include "global_numbering.hpp"
 #include <petsc.h>
+#include <vector>
 
 namespace samurai
 {
     namespace petsc
     {
+        /**
+         * Coefficients of one row of a matrix, inserted by a single call to MatSetValues
+         * instead of one call to MatSetValue (i.e. one lookup in the matrix) per coefficient.
+         * The buffers keep their capacity from one row to the next.
+         */
+        class MatrixRow
+        {
+          public:
+
+            void reset(PetscInt row)
+            {
+                m_row = row;
+                m_cols.clear();
+                m_values.clear();
+            }
+
+            void add(PetscInt col, PetscScalar value)
+            {
+                m_cols.push_back(col);
+                m_values.push_back(value);
+            }
+
+            PetscInt row() const
+            {
+                return m_row;
+            }
+
+            std::size_t size() const
+            {
+                return m_cols.size();
+            }
+
+            /**
+             * Inserts the coefficients of the row in the matrix. With INSERT_VALUES, a column added
+             * twice gets the last value, as with successive calls to MatSetValue.
+             */
+            PetscErrorCode insert(Mat& A, InsertMode mode) const
+            {
+                if (m_cols.empty())
+                {
+                    return 0;
+                }
+                return set_values(A, 1, &m_row, static_cast<PetscInt>(m_cols.size()), m_cols.data(), m_values.data(), mode);
+            }
+
+          private:
+
+            PetscInt m_row = 0;
+            std::vector<PetscInt> m_cols;
+            std::vector<PetscScalar> m_values;
+        };
+
         class MatrixAssembly
         {
           private:
@@ -28,6 +82,7 @@ namespace samurai
             PetscInt m_col_shift        = 0;
             PetscInt m_rows             = 0;
             PetscInt m_cols             = 0;
+            GlobalNumbering m_numbering; // numbering of the unknowns across the MPI processes
 
           public:
 
@@ -157,6 +212,18 @@ namespace samurai
                 m_current_insert_mode = insert_mode;
             }
 
+            const GlobalNumbering& numbering() const
+            {
+                return m_numbering;
+            }
+
+            /**
+             * @brief Updates the numbering of the unknowns across the MPI processes (collective).
+             */
+            virtual void update_numbering()
+            {
+            }
+
             /**
              * @brief Performs the memory preallocation of the Petsc matrix.
              * @see assemble_matrix
@@ -166,6 +233,16 @@ namespace samurai
                 times::timers.start("matrix assembly");
 
                 reset();
+                if (!m_is_block)
+                {
+                    update_numbering();
+                }
+                if (m_numbering.is_distributed() && !m_is_block)
+                {
+                    times::timers.stop("matrix assembly");
+                    create_distributed_matrix(A);
+                    return;
+                }
                 auto m = matrix_rows();
                 auto n = matrix_cols();
 
@@ -204,6 +281,44 @@ namespace samurai
                 times::timers.stop("matrix assembly");
             }
 
+          private:
+
+            /**
+             * Distributed matrix, whose rows are those of the unknowns owned by the process.
+             * The sparsity pattern hooks only count the coefficients of each row: the split of the rows
+             * between the diagonal block (columns owned by the process) and the off-diagonal one is
+             * obtained by a first assembly into a MATPREALLOCATOR matrix, which only records the structure.
+             */
+            void create_distributed_matrix(Mat& A)
+            {
+                auto n = m_numbering.owned_size();
+                auto N = m_numbering.global_size();
+
+                Mat preallocator;
+                MatCreate(PETSC_COMM_WORLD, &preallocator);
+                MatSetType(preallocator, MATPREALLOCATOR);
+                MatSetSizes(preallocator, n, n, N, N);
+                MatSetLocalToGlobalMapping(preallocator, m_numbering.row_mapping(), m_numbering.col_mapping());
+                MatSetUp(preallocator);
+                assemble_matrix(preallocator);
+                reset(); // the assembly starts again from empty rows
+
+                times::timers.start("matrix assembly");
+                MatCreate(PETSC_COMM_WORLD, &A);
+                MatSetSizes(A, n, n, N, N);
+                MatSetType(A, MATAIJ);
+                MatSetFromOptions(A);
+                PetscObjectSetName(reinterpret_cast<PetscObject>(A), m_name.c_str());
+                MatPreallocatorPreallocate(preallocator, PETSC_TRUE, A);
+                MatDestroy(&preallocator);
+                MatSetLocalToGlobalMapping(A, m_numbering.row_mapping(), m_numbering.col_mapping());
+                // the rows of the unknowns not owned are mapped to -1: no value is sent to another process
+                MatSetOption(A, MAT_NO_OFF_PROC_ENTRIES, PETSC_TRUE);
+                times::timers.stop("matrix assembly");
+            }
+
+          public:
+
             /**
              * @brief Inserts the coefficent into a preallocated matrix and
              * performs the assembly.
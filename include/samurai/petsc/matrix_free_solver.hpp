@@ -0,0 +1,357 @@
+#pragma once
+
+#include "linear_solver.hpp"
+#include <vector>
+
+namespace samurai
+{
+    namespace petsc
+    {
+        /**
+         * Linear solver whose matrix is not stored: the product by the matrix (PETSc MatShell) is computed
+         * by the explicit application of the scheme.
+         *
+         * The unknowns of the system are the values of the field in all the cells of the mesh, ghosts included.
+         * For the unknown x,
+         *  - the rows of the cells are scheme(x), the ghost values of x being used as they are;
+         *  - the rows of the ghosts are x_g - G(x), where G(x) are the ghost values computed from the cells of x
+         *    by update_ghost_mr() (boundary conditions, projection, prediction), without their constant part
+         *    (the values of the boundary conditions), which goes to the right-hand side.
+         * The solution is the same as the one of the assembled system.
+         *
+         * Only the coefficients coupling the components of a cell (the diagonal for a scalar field) are assembled,
+         * in the preconditioning matrix. By default, the preconditioner is Jacobi (point-block Jacobi for vector
+         * fields stored as arrays of structures); with -pc_type none, no matrix is assembled at all.
+         */
+        template <class Scheme>
+        class MatrixFreeSolver : public LinearSolverBase<Assembly<Scheme>>
+        {
+            using base_class = LinearSolverBase<Assembly<Scheme>>;
+            using scheme_t   = Scheme;
+            using Field      = typename scheme_t::field_t;
+
+            using base_class::assembly;
+            using base_class::m_A;
+            using base_class::m_is_set_up;
+            using base_class::m_ksp;
+
+            static_assert(std::is_same_v<typename scheme_t::output_field_t, Field>,
+                          "The matrix-free solver requires a scheme whose output field has the type of the unknown.");
+
+            static constexpr std::size_t n_comp = Field::n_comp;
+            static constexpr bool point_blocks  = n_comp > 1 && !samurai::detail::is_soa_v<Field>;
+
+          private:
+
+            Mat m_P = nullptr; ///< preconditioning matrix: coupling of the components of each cell
+            std::vector<PetscInt> m_ghost_rows;
+
+            // Work fields of the matrix-vector product
+            Field m_x;       ///< copy of the vector multiplied
+            Field m_ghosts;  ///< ghost values computed from the cells of m_x
+            Field m_bc_part; ///< ghost values computed from cells set to 0: the constant part of the ghost values
+            Field m_Ax;      ///< explicit application of the scheme
+
+          public:
+
+            explicit MatrixFreeSolver(scheme_t& scheme)
+                : base_class(scheme)
+            {
+                _configure_solver();
+            }
+
+            ~MatrixFreeSolver() override
+            {
+                _destroy_preconditioning_matrix();
+            }
+
+            MatrixFreeSolver& operator=(MatrixFreeSolver&& other)
+            {
+                if (this != &other)
+                {
+                    base_class::operator=(std::move(other));
+                    m_P          = other.m_P;
+                    m_ghost_rows = std::move(other.m_ghost_rows);
+                    m_x          = std::move(other.m_x);
+                    m_ghosts     = std::move(other.m_ghosts);
+                    m_bc_part    = std::move(other.m_bc_part);
+                    m_Ax         = std::move(other.m_Ax);
+                    other.m_P    = nullptr; // Prevent the destruction of the matrix when 'other' object is destroyed
+                }
+                return *this;
+            }
+
+            void destroy_petsc_objects() override
+            {
+                base_class::destroy_petsc_objects();
+                _destroy_preconditioning_matrix();
+            }
+
+          private:
+
+            void _destroy_preconditioning_matrix()
+            {
+                if (m_P)
+                {
+                    MatDestroy(&m_P);
+                    m_P = nullptr;
+                }
+            }
+
+            void _configure_solver()
+            {
+                if (m_ksp == nullptr)
+                {
+                    KSPCreate(PETSC_COMM_SELF, &m_ksp);
+                }
+                PC pc;
+                KSPGetPC(m_ksp, &pc);
+                PCSetType(pc, point_blocks ? PCPBJACOBI : PCJACOBI); // default, overridden by the options
+                KSPSetFromOptions(m_ksp);
+            }
+
+          protected:
+
+            void configure_solver() override
+            {
+                _configure_solver();
+            }
+
+          public:
+
+            void set_unknown(Field& unknown)
+            {
+                assembly().set_unknown(unknown);
+            }
+
+            void setup() override
+            {
+                if (m_is_set_up)
+                {
+                    return;
+                }
+#ifdef SAMURAI_WITH_MPI
+                if (mpi::communicator().size() > 1)
+                {
+                    std::cerr << "The matrix-free solver is not distributed: it runs on a single MPI process." << std::endl;
+                    assert(false && "Distributed matrix-free solver");
+                    exit(EXIT_FAILURE);
+                }
+#endif
+                if (assembly().undefined_unknown())
+                {
+                    std::cerr << "Undefined unknown for this linear system. Please set the unknown using the instruction '[solver].set_unknown(u);'."
+                              << std::endl;
+                    assert(false && "Undefined unknown");
+                    exit(EXIT_FAILURE);
+                }
+
+                auto& unknown = assembly().unknown();
+                auto& mesh    = unknown.mesh();
+                m_x           = Field("matrix_free_x", mesh);
+                m_ghosts      = Field("matrix_free_ghosts", mesh);
+                m_bc_part     = Field("matrix_free_bc", mesh);
+                m_Ax          = Field("matrix_free_Ax", mesh);
+                // the work fields are new: their boundary conditions are copied once for this mesh
+                m_ghosts.copy_bc_from(unknown);
+                m_bc_part.copy_bc_from(unknown);
+
+                // Rows of the ghosts: the entries not covered by the cells
+                m_ghosts.fill(0);
+                for_each_interval(mesh,
+                                  [&](std::size_t level, const auto& i, const auto& index)
+                                  {
+                                      m_ghosts(level, i, index).fill(1);
+                                  });
+                m_ghost_rows.clear();
+                for (std::size_t row = 0; row < m_ghosts.array().size(); ++row)
+                {
+                    if (m_ghosts.array().data()[row] == 0)
+                    {
+                        m_ghost_rows.push_back(static_cast<PetscInt>(row));
+                    }
+                }
+
+                auto n = static_cast<PetscInt>(mesh.nb_cells() * n_comp);
+                MatCreateShell(PETSC_COMM_SELF, n, n, n, n, this, &m_A);
+                MatShellSetOperation(m_A, MATOP_MULT, reinterpret_cast<void (*)(void)>(PETSC_mult));
+                PetscObjectSetName(reinterpret_cast<PetscObject>(m_A), "A");
+
+                PC pc;
+                KSPGetPC(m_ksp, &pc);
+                PetscBool no_pc;
+                PetscObjectTypeCompare(reinterpret_cast<PetscObject>(pc), PCNONE, &no_pc);
+                if (no_pc)
+                {
+                    KSPSetOperators(m_ksp, m_A, m_A);
+                }
+                else
+                {
+                    create_preconditioning_matrix(n);
+                    assemble_preconditioning_matrix();
+                    KSPSetOperators(m_ksp, m_A, m_P);
+                }
+
+                times::timers.start("solver setup");
+                KSPSetUp(m_ksp);
+                times::timers.stop("solver setup");
+                m_is_set_up          = true;
+                this->m_mesh_version = this->mesh_version();
+            }
+
+            /**
+             * The product by the matrix applies the scheme each time: only the preconditioning matrix is assembled again.
+             */
+            void reassemble_matrix() override
+            {
+                if (m_A == nullptr || !m_is_set_up || this->mesh_version() != this->m_mesh_version)
+                {
+                    this->reset();
+                    setup();
+                    return;
+                }
+                if (m_P)
+                {
+                    MatZeroEntries(m_P);
+                    assemble_preconditioning_matrix();
+                    KSPSetOperators(m_ksp, m_A, m_P);
+                }
+            }
+
+            void solve(const Field& rhs)
+            {
+                this->reset_if_mesh_changed();
+                if (!m_is_set_up)
+                {
+                    setup();
+                }
+                // the solver may have been moved since the creation of the matrix
+                MatShellSetContext(m_A, this);
+
+                auto& unknown = assembly().unknown();
+
+                // Constant part of the ghost values: right-hand side of the rows of the ghosts
+                m_bc_part.fill(0);
+                update_ghost_mr(m_bc_part);
+
+                Field b_field = m_bc_part;
+                for_each_interval(b_field.mesh(),
+                                  [&](std::size_t level, const auto& i, const auto& index)
+                                  {
+                                      noalias(b_field(level, i, index)) = rhs(level, i, index);
+                                  });
+
+                Vec b = create_petsc_vector_from(b_field);
+                PetscObjectSetName(reinterpret_cast<PetscObject>(b), "b");
+                Vec x = create_petsc_vector_from(unknown);
+                this->solve_system(b, x);
+
+                VecDestroy(&b);
+                VecDestroy(&x);
+            }
+
+            void solve(Field& unknown, const Field& rhs)
+            {
+                set_unknown(unknown);
+                solve(rhs);
+            }
+
+          private:
+
+            /**
+             * y = A*x, A being the matrix of the assembled system.
+             */
+            void mult(Vec& x, Vec& y)
+            {
+                copy(x, m_x);
+
+                // Rows of the cells
+                assembly().scheme().apply_to(m_Ax, m_x);
+
+                // Rows of the ghosts: x_g - G(x)
+                m_ghosts.fill(0);
+                for_each_interval(m_x.mesh(),
+                                  [&](std::size_t level, const auto& i, const auto& index)
+                                  {
+                                      noalias(m_ghosts(level, i, index)) = m_x(level, i, index);
+                                  });
+                update_ghost_mr(m_ghosts);
+                m_ghosts.array() = m_x.array() - m_ghosts.array() + m_bc_part.array();
+
+                for_each_interval(m_x.mesh(),
+                                  [&](std::size_t level, const auto& i, const auto& index)
+                                  {
+                                      noalias(m_ghosts(level, i, index)) = m_Ax(level, i, index);
+                                  });
+                copy(m_ghosts, y);
+            }
+
+            static PetscErrorCode PETSC_mult(Mat A, Vec x, Vec y)
+            {
+                MatrixFreeSolver* self;
+                MatShellGetContext(A, &self);
+                self->mult(x, y);
+                return 0; // PETSC_SUCCESS
+            }
+
+            /**
+             * Row of the unknown component c of the cell of index cell_index
+             */
+            PetscInt row_index(PetscInt cell_index, PetscInt c, PetscInt n_cells) const
+            {
+                if constexpr (samurai::detail::is_soa_v<Field>)
+                {
+                    return c * n_cells + cell_index;
+                }
+                else
+                {
+                    return cell_index * static_cast<PetscInt>(n_comp) + c;
+                }
+            }
+
+            /**
+             * Preallocates and inserts the coupling of the components of each cell, the only coefficients kept
+             * when the system is assembled in the matrix: the other insertions are ignored by PETSc
+             * (MAT_NEW_NONZERO_LOCATIONS), so that the matrix never holds more than n_comp coefficients per row.
+             */
+            void create_preconditioning_matrix(PetscInt n)
+            {
+                times::timers.start("matrix assembly");
+                MatCreate(PETSC_COMM_SELF, &m_P);
+                MatSetSizes(m_P, n, n, n, n);
+                MatSetType(m_P, MATSEQAIJ);
+                if constexpr (point_blocks)
+                {
+                    MatSetBlockSize(m_P, static_cast<PetscInt>(n_comp));
+                }
+                MatSeqAIJSetPreallocation(m_P, static_cast<PetscInt>(n_comp), nullptr);
+                PetscObjectSetName(reinterpret_cast<PetscObject>(m_P), "P");
+
+                auto n_cells = n / static_cast<PetscInt>(n_comp);
+                for (PetscInt cell = 0; cell < n_cells; ++cell)
+                {
+                    for (PetscInt c1 = 0; c1 < static_cast<PetscInt>(n_comp); ++c1)
+                    {
+                        for (PetscInt c2 = 0; c2 < static_cast<PetscInt>(n_comp); ++c2)
+                        {
+                            MatSetValue(m_P, row_index(cell, c1, n_cells), row_index(cell, c2, n_cells), 0, INSERT_VALUES);
+                        }
+                    }
+                }
+                MatAssemblyBegin(m_P, MAT_FINAL_ASSEMBLY);
+                MatAssemblyEnd(m_P, MAT_FINAL_ASSEMBLY);
+                MatSetOption(m_P, MAT_NEW_NONZERO_LOCATIONS, PETSC_FALSE);
+                times::timers.stop("matrix assembly");
+            }
+
+            void assemble_preconditioning_matrix()
+            {
+                assembly().reset();
+                assembly().assemble_matrix(m_P);
+                // The rows of the ghosts are the identity in the matrix-free operator
+                MatZeroRows(m_P, static_cast<PetscInt>(m_ghost_rows.size()), m_ghost_rows.data(), 1., nullptr, nullptr);
+            }
+        };
+
+    } // end namespace petsc
+} // end namespace samurai
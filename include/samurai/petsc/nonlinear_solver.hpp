@@ -111,7 +111,7 @@ namespace samurai
 
             void _configure_solver()
             {
-                SNESCreate(PETSC_COMM_SELF, &m_snes);
+                SNESCreate(solver_communicator(), &m_snes);
                 SNESSetType(m_snes, SNESNEWTONLS);
             }
 
@@ -168,7 +168,7 @@ namespace samurai
 
                 // Wrap a field structure around the data of the Petsc vector x
                 field_t x_field("newton", mesh);
-                copy(x, x_field); // This is really bad... TODO: create a field constructor that takes a double*
+                self->copy_to_field(x, x_field);
 
                 // Transfer B.C. to the new field (required to be able to apply the explicit scheme)
                 x_field.copy_bc_from(assembly.unknown());
@@ -178,8 +178,18 @@ namespace samurai
                 update_ghost_mr(x_field);
                 auto f_field = self->scheme()(x_field);
 
-                copy(f_field, f);
-                self->prepare_rhs(f);
+                if (self->is_distributed())
+                {
+                    Vec f_local = create_petsc_vector_from(f_field);
+                    self->prepare_rhs(f_local);
+                    assembly.numbering().to_global(f_local, f);
+                    VecDestroy(&f_local);
+                }
+                else
+                {
+                    copy(f_field, f);
+                    self->prepare_rhs(f);
+                }
 
                 times::timers.start("nonlinear system solve");
                 return 0; // PETSC_SUCCESS
@@ -196,7 +206,12 @@ namespace samurai
 
                 // Wrap a field structure around the data of the Petsc vector x
                 field_t x_field("newton_jac_x", assembly.unknown().mesh());
-                copy(x, x_field); // This is really bad... TODO: create a field constructor that takes a double*
+                self->copy_to_field(x, x_field);
+                if (self->is_distributed())
+                {
+                    // values of the entries owned by the neighbours, used by the coefficients of the owned rows
+                    update_ghost_subdomains(x_field);
+                }
 
                 // Transfer B.C. to the new field,
                 // so that the assembly process has B.C. to enforce in the matrix
@@ -231,6 +246,32 @@ namespace samurai
 
           protected:
 
+            /**
+             * True if the system is distributed across the MPI processes (see GlobalNumbering).
+             */
+            bool is_distributed() const
+            {
+                return m_assembly.numbering().is_distributed();
+            }
+
+            /**
+             * Copies the vector of the unknowns of the system into the field. If the system is distributed,
+             * only the owned entries are set: the other ones are received by the ghost update.
+             */
+            void copy_to_field(Vec& x, field_t& x_field)
+            {
+                if (is_distributed())
+                {
+                    Vec x_local = create_petsc_vector_from(x_field);
+                    m_assembly.numbering().to_local(x, x_local);
+                    VecDestroy(&x_local);
+                }
+                else
+                {
+                    copy(x, x_field); // This is really bad... TODO: create a field constructor that takes a double*
+                }
+            }
+
             void prepare_rhs(Vec& b)
             {
                 assembly().set_0_for_all_ghosts(b);
@@ -256,7 +297,23 @@ namespace samurai
             {
                 // Solve the system
                 times::timers.start("nonlinear system solve");
-                SNESSolve(m_snes, b, x);
+                if (is_distributed())
+                {
+                    // b and x are stored as the fields: only their owned entries are unknowns of the distributed system
+                    const auto& numbering = m_assembly.numbering();
+                    Vec b_global          = numbering.create_vector();
+                    Vec x_global          = numbering.create_vector();
+                    numbering.to_global(b, b_global);
+                    numbering.to_global(x, x_global);
+                    SNESSolve(m_snes, b_global, x_global);
+                    numbering.to_local(x_global, x);
+                    VecDestroy(&b_global);
+                    VecDestroy(&x_global);
+                }
+                else
+                {
+                    SNESSolve(m_snes, b, x);
+                }
                 times::timers.stop("nonlinear system solve");
 
                 SNESConvergedReason reason_code;
@@ -330,6 +387,12 @@ namespace samurai
 
                 VecDestroy(&b);
                 VecDestroy(&x);
+
+                if (this->is_distributed())
+                {
+                    // values of the entries owned by the neighbours
+                    update_ghost_subdomains(assembly().unknown());
+                }
             }
 
             void solve(Field& unknown, Field& rhs)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "linear_block_solver.hpp"
+#include "matrix_free_solver.hpp"
 #include "nonlinear_local_solvers.hpp"
 #include "nonlinear_solver.hpp"
 
@@ -19,6 +20,13 @@ namespace samurai
             return LinearSolver<Scheme>(scheme);
         }
 
+        // Linear solver without stored matrix
+        template <class Scheme, std::enable_if_t<Scheme::cfg_t::scheme_type != SchemeType::NonLinear, bool> = true>
+        auto make_matrix_free_solver(Scheme& scheme)
+        {
+            return MatrixFreeSolver<Scheme>(scheme);
+        }
+
         // Linear block solver (choice monolithic or not)
         template <bool monolithic, std::size_t rows, std::size_t cols, class... Operators>
         auto make_solver(BlockOperator<rows, cols, Operators...>& block_operator)
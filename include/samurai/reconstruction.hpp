@@ -1,10 +1,12 @@
 #pragma once
 
 #include <array>
+#include <cassert>
 #include <fmt/format.h>
 #include <fmt/ranges.h>
-#include <tuple>
-#include <unordered_map>
+#include <map>
+#include <mutex>
+#include <vector>
 
 #include "field.hpp"
 #include "numeric/prediction.hpp"
@@ -157,131 +159,272 @@ namespace samurai
         return out;
     }
 
-    template <std::size_t order = 1, class index_t = default_config::value_t>
-    auto prediction(std::size_t level, index_t i) -> prediction_map<1, index_t>
+    namespace detail
     {
-        static std::map<std::tuple<std::size_t, std::size_t, index_t>, prediction_map<1, index_t>> values;
-
-        if (level == 0)
+        /**
+         * Coefficients of the 1D prediction from a coarse cell to its 2^delta_l children,
+         * stored in a flat dense array: the predicted value of the child c is
+         * sum_k row(c)[k] * u(first_offset() + k), where u is indexed relative to the
+         * coarse cell. The predictions in 2D and 3D are the tensor products of the 1D ones.
+         */
+        class prediction_table
         {
-            return prediction_map<1, index_t>{{i}};
-        }
+          public:
 
-        auto iter = values.find({order, level, i});
+            prediction_table() = default;
 
-        if (iter == values.end())
-        {
-            int ig      = i >> 1;
-            double sign = (i & 1) ? -1. : 1.;
+            prediction_table(int first_offset, std::size_t width, std::size_t nb_children)
+                : m_first_offset(first_offset)
+                , m_width(width)
+                , m_coeffs(width * nb_children, 0.)
+            {
+            }
 
-            values[{order, level, i}] = prediction<order, index_t>(level - 1, ig);
+            int first_offset() const
+            {
+                return m_first_offset;
+            }
 
-            auto interp = interp_coeffs<2 * order + 1>(sign);
-            for (std::size_t ci = 0; ci < interp.size(); ++ci)
+            std::size_t width() const
             {
-                if (ci != order)
-                {
-                    values[{order, level, i}] += interp[ci] * prediction<order, index_t>(level - 1, ig + static_cast<index_t>(ci - order));
-                }
+                return m_width;
             }
-            return values[{order, level, i}];
-        }
-        return iter->second;
-    }
 
-    template <std::size_t order = 1, class index_t = default_config::value_t>
-    auto prediction(std::size_t level, index_t i, index_t j) -> prediction_map<2, index_t>
-    {
-        static std::map<std::tuple<std::size_t, std::size_t, index_t, index_t>, prediction_map<2, index_t>> values;
+            const double* row(std::size_t child) const
+            {
+                return m_coeffs.data() + child * m_width;
+            }
 
-        if (level == 0)
-        {
-            return prediction_map<2, index_t>{
-                {i, j}
-            };
-        }
+            double* row(std::size_t child)
+            {
+                return m_coeffs.data() + child * m_width;
+            }
+
+          private:
 
-        auto iter = values.find({order, level, i, j});
+            int m_first_offset = 0;
+            std::size_t m_width = 1;
+            std::vector<double> m_coeffs{1.};
+        };
 
-        if (iter == values.end())
+        template <std::size_t order>
+        prediction_table build_prediction_table(std::size_t delta_l)
         {
-            int ig       = i >> 1;
-            int jg       = j >> 1;
-            double isign = (i & 1) ? -1. : 1.;
-            double jsign = (j & 1) ? -1. : 1.;
+            static constexpr int iorder = static_cast<int>(order);
 
-            values[{order, level, i, j}] = prediction<order, index_t>(level - 1, ig, jg);
+            const int nb_children = 1 << delta_l;
+
+            // bounds of the stencils of all the children on the coarse level
+            int lo = 0;
+            int hi = nb_children - 1;
+            for (std::size_t l = 0; l < delta_l; ++l)
+            {
+                lo = (lo >> 1) - iorder;
+                hi = (hi >> 1) + iorder;
+            }
 
-            auto interpx = interp_coeffs<2 * order + 1>(isign);
-            auto interpy = interp_coeffs<2 * order + 1>(jsign);
+            prediction_table table(lo, static_cast<std::size_t>(hi - lo + 1), static_cast<std::size_t>(nb_children));
 
-            for (std::size_t ci = 0; ci < interpx.size(); ++ci)
+            // The prediction of a cell is the interpolation of its parent and of the neighbours of its parent:
+            // the coefficients are pushed from the child to the coarse level, one level at a time.
+            std::vector<double> current;
+            std::vector<double> next;
+            for (int child = 0; child < nb_children; ++child)
             {
-                for (std::size_t cj = 0; cj < interpy.size(); ++cj)
+                int first = child;
+                current.assign(1, 1.);
+                for (std::size_t l = 0; l < delta_l; ++l)
                 {
-                    if (ci != order || cj != order)
+                    const int last = first + static_cast<int>(current.size()) - 1;
+                    next.assign(static_cast<std::size_t>((last >> 1) - (first >> 1) + 2 * iorder + 1), 0.);
+                    for (std::size_t c = 0; c < current.size(); ++c)
                     {
-                        values[{order, level, i, j}] += interpx[ci] * interpy[cj]
-                                                      * prediction<order, index_t>(level - 1,
-                                                                                   ig + static_cast<index_t>(ci - order),
-                                                                                   jg + static_cast<index_t>(cj - order));
+                        const int x       = first + static_cast<int>(c);
+                        const auto interp = interp_coeffs<2 * order + 1>((x & 1) ? -1. : 1.);
+                        const auto base   = static_cast<std::size_t>((x >> 1) - (first >> 1));
+                        for (std::size_t k = 0; k < interp.size(); ++k)
+                        {
+                            next[base + k] += current[c] * interp[k];
+                        }
                     }
+                    std::swap(current, next);
+                    first = (first >> 1) - iorder;
                 }
+                std::copy(current.cbegin(), current.cend(), table.row(static_cast<std::size_t>(child)) + (first - lo));
             }
-            return values[{order, level, i, j}];
+            return table;
         }
-        return iter->second;
-    }
 
-    template <std::size_t order = 1, class index_t = default_config::value_t>
-    auto prediction(std::size_t level, index_t i, index_t j, index_t k) -> prediction_map<3, index_t>
-    {
-        static std::map<std::tuple<std::size_t, std::size_t, index_t, index_t, index_t>, prediction_map<3, index_t>> values;
+        /**
+         * Immutable table of the prediction coefficients of the given order for delta_l levels.
+         * It is built at its first use and can then be read concurrently by several threads.
+         */
+        template <std::size_t order>
+        const prediction_table& get_prediction_table(std::size_t delta_l)
+        {
+            static std::array<std::once_flag, default_config::max_level + 1> built;
+            static std::array<prediction_table, default_config::max_level + 1> tables;
+
+            assert(delta_l < tables.size());
+            std::call_once(built[delta_l],
+                           [&]()
+                           {
+                               tables[delta_l] = build_prediction_table<order>(delta_l);
+                           });
+            return tables[delta_l];
+        }
+
+        /// 1D prediction coefficients coeffs[0..width[ applied at the offsets first_offset + k
+        template <class index_t>
+        struct prediction_stencil_1d
+        {
+            index_t first_offset;
+            std::size_t width;
+            const double* coeffs;
+        };
 
-        if (level == 0)
+        /// 1D prediction stencil of the child `child` (at delta_l levels above the coarse cell 0)
+        template <std::size_t order, class index_t>
+        auto prediction_stencil(std::size_t delta_l, index_t child)
         {
-            return prediction_map<3, index_t>{
-                {i, j, k}
-            };
+            const auto& table   = get_prediction_table<order>(delta_l);
+            const index_t shift = child >> delta_l;
+            const auto row      = static_cast<std::size_t>(child - (shift << delta_l));
+            return prediction_stencil_1d<index_t>{static_cast<index_t>(table.first_offset()) + shift, table.width(), table.row(row)};
         }
 
-        auto iter = values.find({order, level, i, j, k});
+        /// Sum of the 1D prediction stencils of the children of an interval
+        template <class index_t>
+        struct summed_prediction_stencil
+        {
+            index_t first_offset = 0;
+            std::vector<double> coeffs;
+
+            auto view() const
+            {
+                return prediction_stencil_1d<index_t>{first_offset, coeffs.size(), coeffs.data()};
+            }
+        };
 
-        if (iter == values.end())
+        template <std::size_t order, class TInterval>
+        auto prediction_stencil_sum(std::size_t delta_l, const TInterval& children)
         {
-            int ig       = i >> 1;
-            int jg       = j >> 1;
-            int kg       = k >> 1;
-            double isign = (i & 1) ? -1. : 1.;
-            double jsign = (j & 1) ? -1. : 1.;
-            double ksign = (k & 1) ? -1. : 1.;
+            using index_t = typename TInterval::value_t;
 
-            values[{order, level, i, j, k}] = prediction<order, index_t>(level - 1, ig, jg, kg);
+            summed_prediction_stencil<index_t> sum;
+            if (children.is_empty())
+            {
+                return sum;
+            }
 
-            auto interpx = interp_coeffs<2 * order + 1>(isign);
-            auto interpy = interp_coeffs<2 * order + 1>(jsign);
-            auto interpz = interp_coeffs<2 * order + 1>(ksign);
+            const auto first = prediction_stencil<order>(delta_l, children.start);
+            const auto last  = prediction_stencil<order>(delta_l, children.end - 1);
+            sum.first_offset = first.first_offset;
+            sum.coeffs.assign(static_cast<std::size_t>(last.first_offset - first.first_offset) + last.width, 0.);
+            for (auto c = children.start; c < children.end; ++c)
+            {
+                const auto s = prediction_stencil<order>(delta_l, c);
+                auto* out    = sum.coeffs.data() + (s.first_offset - sum.first_offset);
+                for (std::size_t k = 0; k < s.width; ++k)
+                {
+                    out[k] += s.coeffs[k];
+                }
+            }
+            return sum;
+        }
+
+        // Apply f(offsets..., coeff) for each non-zero coefficient of the tensor product of the 1D stencils
+        template <class index_t, class Func>
+        void for_each_prediction_coeff(const prediction_stencil_1d<index_t>& sx, Func&& f)
+        {
+            for (std::size_t a = 0; a < sx.width; ++a)
+            {
+                if (sx.coeffs[a] != 0.)
+                {
+                    f(sx.first_offset + static_cast<index_t>(a), sx.coeffs[a]);
+                }
+            }
+        }
 
-            for (std::size_t ci = 0; ci < interpx.size(); ++ci)
+        template <class index_t, class Func>
+        void for_each_prediction_coeff(const prediction_stencil_1d<index_t>& sx, const prediction_stencil_1d<index_t>& sy, Func&& f)
+        {
+            for (std::size_t a = 0; a < sx.width; ++a)
             {
-                for (std::size_t cj = 0; cj < interpy.size(); ++cj)
+                for (std::size_t b = 0; b < sy.width; ++b)
                 {
-                    for (std::size_t ck = 0; ck < interpz.size(); ++ck)
+                    const double coeff = sx.coeffs[a] * sy.coeffs[b];
+                    if (coeff != 0.)
                     {
-                        if (ci != order || cj != order || ck != order)
+                        f(sx.first_offset + static_cast<index_t>(a), sy.first_offset + static_cast<index_t>(b), coeff);
+                    }
+                }
+            }
+        }
+
+        template <class index_t, class Func>
+        void for_each_prediction_coeff(const prediction_stencil_1d<index_t>& sx,
+                                       const prediction_stencil_1d<index_t>& sy,
+                                       const prediction_stencil_1d<index_t>& sz,
+                                       Func&& f)
+        {
+            for (std::size_t a = 0; a < sx.width; ++a)
+            {
+                for (std::size_t b = 0; b < sy.width; ++b)
+                {
+                    for (std::size_t c = 0; c < sz.width; ++c)
+                    {
+                        const double coeff = sx.coeffs[a] * sy.coeffs[b] * sz.coeffs[c];
+                        if (coeff != 0.)
                         {
-                            values[{order, level, i, j, k}] += interpx[ci] * interpy[cj] * interpz[ck]
-                                                             * prediction<order, index_t>(level - 1,
-                                                                                          ig + static_cast<index_t>(ci - order),
-                                                                                          jg + static_cast<index_t>(cj - order),
-                                                                                          kg + static_cast<index_t>(ck - order));
+                            f(sx.first_offset + static_cast<index_t>(a),
+                              sy.first_offset + static_cast<index_t>(b),
+                              sz.first_offset + static_cast<index_t>(c),
+                              coeff);
                         }
                     }
                 }
             }
-            return values[{order, level, i, j, k}];
         }
-        return iter->second;
+    }
+
+    template <std::size_t order = 1, class index_t = default_config::value_t>
+    auto prediction(std::size_t level, index_t i) -> prediction_map<1, index_t>
+    {
+        prediction_map<1, index_t> values;
+        detail::for_each_prediction_coeff(detail::prediction_stencil<order>(level, i),
+                                          [&](index_t di, double coeff)
+                                          {
+                                              values.coeff[{di}] = coeff;
+                                          });
+        return values;
+    }
+
+    template <std::size_t order = 1, class index_t = default_config::value_t>
+    auto prediction(std::size_t level, index_t i, index_t j) -> prediction_map<2, index_t>
+    {
+        prediction_map<2, index_t> values;
+        detail::for_each_prediction_coeff(detail::prediction_stencil<order>(level, i),
+                                          detail::prediction_stencil<order>(level, j),
+                                          [&](index_t di, index_t dj, double coeff)
+                                          {
+                                              values.coeff[{di, dj}] = coeff;
+                                          });
+        return values;
+    }
+
+    template <std::size_t order = 1, class index_t = default_config::value_t>
+    auto prediction(std::size_t level, index_t i, index_t j, index_t k) -> prediction_map<3, index_t>
+    {
+        prediction_map<3, index_t> values;
+        detail::for_each_prediction_coeff(detail::prediction_stencil<order>(level, i),
+                                          detail::prediction_stencil<order>(level, j),
+                                          detail::prediction_stencil<order>(level, k),
+                                          [&](index_t di, index_t dj, index_t dk, double coeff)
+                                          {
+                                              values.coeff[{di, dj, dk}] = coeff;
+                                          });
+        return values;
     }
 
     template <std::size_t dim, class TInterval>
@@ -307,13 +450,13 @@ namespace samurai
                 index_t nb_cells = 1 << delta_l;
                 for (index_t ii = 0; ii < nb_cells; ++ii)
                 {
-                    auto pred = prediction<prediction_order, index_t>(delta_l, ii);
-                    for (const auto& kv : pred.coeff)
-                    {
-                        auto i_f = (i << delta_l) + ii;
-                        i_f.step = nb_cells;
-                        dest(reconstruct_level, i_f) += kv.second * src(level, i + kv.first[0]);
-                    }
+                    auto i_f = (i << delta_l) + ii;
+                    i_f.step = nb_cells;
+                    detail::for_each_prediction_coeff(detail::prediction_stencil<prediction_order>(delta_l, ii),
+                                                      [&](index_t di, double coeff)
+                                                      {
+                                                          dest(reconstruct_level, i_f) += coeff * src(level, i + di);
+                                                      });
                 }
             }
         }
@@ -335,16 +478,17 @@ namespace samurai
                 for (index_t jj = 0; jj < nb_cells; ++jj)
                 {
                     auto j_f = (j << delta_l) + jj;
+                    auto sy  = detail::prediction_stencil<prediction_order>(delta_l, jj);
                     for (index_t ii = 0; ii < nb_cells; ++ii)
                     {
-                        auto pred = prediction<prediction_order, index_t>(delta_l, ii, jj);
-                        auto i_f  = (i << delta_l) + ii;
-                        i_f.step  = nb_cells;
-
-                        for (const auto& kv : pred.coeff)
-                        {
-                            dest(reconstruct_level, i_f, j_f) += kv.second * src(level, i + kv.first[0], j + kv.first[1]);
-                        }
+                        auto i_f = (i << delta_l) + ii;
+                        i_f.step = nb_cells;
+                        detail::for_each_prediction_coeff(detail::prediction_stencil<prediction_order>(delta_l, ii),
+                                                          sy,
+                                                          [&](index_t di, index_t dj, double coeff)
+                                                          {
+                                                              dest(reconstruct_level, i_f, j_f) += coeff * src(level, i + di, j + dj);
+                                                          });
                     }
                 }
             }
@@ -367,20 +511,23 @@ namespace samurai
                 for (index_t kk = 0; kk < nb_cells; ++kk)
                 {
                     auto k_f = (k << delta_l) + kk;
+                    auto sz  = detail::prediction_stencil<prediction_order>(delta_l, kk);
                     for (index_t jj = 0; jj < nb_cells; ++jj)
                     {
                         auto j_f = (j << delta_l) + jj;
+                        auto sy  = detail::prediction_stencil<prediction_order>(delta_l, jj);
                         for (index_t ii = 0; ii < nb_cells; ++ii)
                         {
-                            auto pred = prediction<prediction_order, index_t>(delta_l, ii, jj, kk);
-                            auto i_f  = (i << delta_l) + ii;
-                            i_f.step  = nb_cells;
-
-                            for (const auto& kv : pred.coeff)
-                            {
-                                dest(reconstruct_level, i_f, j_f, k_f) += kv.second
-                                                                        * src(level, i + kv.first[0], j + kv.first[1], k + kv.first[2]);
-                            }
+                            auto i_f = (i << delta_l) + ii;
+                            i_f.step = nb_cells;
+                            detail::for_each_prediction_coeff(detail::prediction_stencil<prediction_order>(delta_l, ii),
+                                                              sy,
+                                                              sz,
+                                                              [&](index_t di, index_t dj, index_t dk, double coeff)
+                                                              {
+                                                                  dest(reconstruct_level, i_f, j_f, k_f) += coeff
+                                                                                                          * src(level, i + di, j + dj, k + dk);
+                                                              });
                         }
                     }
                 }
@@ -448,15 +595,15 @@ namespace samurai
                           std::size_t delta_l,
                           typename Field::interval_t::value_t ii)
         {
-            auto pred = prediction<prediction_order, typename Field::interval_t::value_t>(delta_l, ii);
+            using index_t = typename Field::interval_t::value_t;
 
             auto result = zeros_like(f(element, level, i));
 
-            for (const auto& kv : pred.coeff)
-            {
-                // cppcheck-suppress useStlAlgorithm
-                result += kv.second * f(element, level, i + kv.first[0]);
-            }
+            for_each_prediction_coeff(prediction_stencil<prediction_order>(delta_l, ii),
+                                      [&](index_t di, double coeff)
+                                      {
+                                          result += coeff * f(element, level, i + di);
+                                      });
             return result;
         }
 
@@ -469,24 +616,14 @@ namespace samurai
                           const typename Field::interval_t& ii)
         {
             using index_t = typename Field::interval_t::value_t;
-            static std::unordered_map<std::tuple<std::size_t, std::size_t, typename Field::interval_t>, prediction_map<1, index_t>> values;
-
-            auto iter = values.find({prediction_order, level, ii});
-            if (iter == values.end())
-            {
-                for (auto ii_ = ii.start; ii_ < ii.end; ++ii_)
-                {
-                    values[{prediction_order, level, ii}] += prediction<prediction_order, index_t>(delta_l, ii_);
-                }
-            }
 
             auto result = zeros_like(f(element, level, i));
 
-            for (const auto& kv : values[{prediction_order, level, ii}].coeff)
-            {
-                // cppcheck-suppress useStlAlgorithm
-                result += kv.second * f(element, level, i + kv.first[0]);
-            }
+            for_each_prediction_coeff(prediction_stencil_sum<prediction_order>(delta_l, ii).view(),
+                                      [&](index_t di, double coeff)
+                                      {
+                                          result += coeff * f(element, level, i + di);
+                                      });
             return result;
         }
 
@@ -499,15 +636,13 @@ namespace samurai
         {
             using index_t = typename Field::interval_t::value_t;
 
-            auto pred = prediction<prediction_order, index_t>(delta_l, ii);
-
             auto result = zeros_like(f(level, i));
 
-            for (const auto& kv : pred.coeff)
-            {
-                // cppcheck-suppress useStlAlgorithm
-                result += kv.second * f(level, i + kv.first[0]);
-            }
+            for_each_prediction_coeff(prediction_stencil<prediction_order>(delta_l, ii),
+                                      [&](index_t di, double coeff)
+                                      {
+                                          result += coeff * f(level, i + di);
+                                      });
             return result;
         }
 
@@ -519,24 +654,14 @@ namespace samurai
                           const typename Field::interval_t& ii)
         {
             using index_t = typename Field::interval_t::value_t;
-            static std::unordered_map<std::tuple<std::size_t, std::size_t, typename Field::interval_t>, prediction_map<1, index_t>> values;
-
-            auto iter = values.find({prediction_order, level, ii});
-            if (iter == values.end())
-            {
-                for (auto ii_ = ii.start; ii_ < ii.end; ++ii_)
-                {
-                    values[{prediction_order, level, ii}] += prediction<prediction_order, index_t>(delta_l, ii_);
-                }
-            }
 
             auto result = zeros_like(f(level, i));
 
-            for (const auto& kv : values[{prediction_order, level, ii}].coeff)
-            {
-                // cppcheck-suppress useStlAlgorithm
-                result += kv.second * f(level, i + kv.first[0]);
-            }
+            for_each_prediction_coeff(prediction_stencil_sum<prediction_order>(delta_l, ii).view(),
+                                      [&](index_t di, double coeff)
+                                      {
+                                          result += coeff * f(level, i + di);
+                                      });
             return result;
         }
 
@@ -553,22 +678,20 @@ namespace samurai
         {
             using index_t = typename Field::interval_t::value_t;
 
-            auto pred = prediction<prediction_order, index_t>(delta_l, ii, jj);
-
             auto result = zeros_like(f(element, level, i, j));
 
-            for (const auto& kv : pred.coeff)
-            {
-                // cppcheck-suppress useStlAlgorithm
-                result += kv.second * f(element, level, i + kv.first[0], j + kv.first[1]);
-            }
+            for_each_prediction_coeff(prediction_stencil<prediction_order>(delta_l, ii),
+                                      prediction_stencil<prediction_order>(delta_l, jj),
+                                      [&](index_t di, index_t dj, double coeff)
+                                      {
+                                          result += coeff * f(element, level, i + di, j + dj);
+                                      });
             return result;
         }
 
         template <std::size_t prediction_order, class Field>
         auto portion_impl(const Field& f,
                           std::size_t element,
-
                           std::size_t level,
                           const typename Field::interval_t& i,
                           typename Field::interval_t::value_t j,
@@ -577,29 +700,15 @@ namespace samurai
                           const typename Field::interval_t& jj)
         {
             using index_t = typename Field::interval_t::value_t;
-            static std::unordered_map<std::tuple<std::size_t, std::size_t, typename Field::interval_t, typename Field::interval_t>,
-                                      prediction_map<2, index_t>>
-                values;
-
-            auto iter = values.find({prediction_order, level, ii, jj});
 
-            if (iter == values.end())
-            {
-                for (auto ii_ = ii.start; ii_ < ii.end; ++ii_)
-                {
-                    for (auto jj_ = jj.start; jj_ < jj.end; ++jj_)
-                    {
-                        values[{prediction_order, level, ii, jj}] += prediction<prediction_order, index_t>(delta_l, ii_, jj_);
-                    }
-                }
-            }
             auto result = zeros_like(f(element, level, i, j));
 
-            for (const auto& kv : values[{prediction_order, level, ii, jj}].coeff)
-            {
-                // cppcheck-suppress useStlAlgorithm
-                result += kv.second * f(element, level, i + kv.first[0], j + kv.first[1]);
-            }
+            for_each_prediction_coeff(prediction_stencil_sum<prediction_order>(delta_l, ii).view(),
+                                      prediction_stencil_sum<prediction_order>(delta_l, jj).view(),
+                                      [&](index_t di, index_t dj, double coeff)
+                                      {
+                                          result += coeff * f(element, level, i + di, j + dj);
+                                      });
             return result;
         }
 
@@ -614,27 +723,26 @@ namespace samurai
         {
             using index_t = typename Field::interval_t::value_t;
 
-            auto pred = prediction<prediction_order, index_t>(delta_l, ii, jj);
-
             auto result = zeros_like(f(level, i, j));
 
-            for (const auto& kv : pred.coeff)
-            {
-                // cppcheck-suppress useStlAlgorithm
-                result += kv.second * f(level, i + kv.first[0], j + kv.first[1]);
+            for_each_prediction_coeff(prediction_stencil<prediction_order>(delta_l, ii),
+                                      prediction_stencil<prediction_order>(delta_l, jj),
+                                      [&](index_t di, index_t dj, double coeff)
+                                      {
+                                          result += coeff * f(level, i + di, j + dj);
 #ifdef SAMURAI_CHECK_NAN
-                if (xt::any(xt::isnan(f(level, i + kv.first[0], j + kv.first[1]))))
-                {
-                    if (i.size() == 1)
-                    {
-                        auto cell = f.mesh().get_cell(level, i.start + kv.first[0], j + kv.first[1]);
-                        std::cerr << "NaN detected in [" << cell << "] when trying to predict a value at level " << (level + delta_l)
-                                  << ". NaN in position {" << kv.first[0] << "," << kv.first[1] << "} of the prediction stencil."
-                                  << std::endl;
-                    }
-                }
+                                          if (xt::any(xt::isnan(f(level, i + di, j + dj))))
+                                          {
+                                              if (i.size() == 1)
+                                              {
+                                                  auto cell = f.mesh().get_cell(level, i.start + di, j + dj);
+                                                  std::cerr << "NaN detected in [" << cell << "] when trying to predict a value at level "
+                                                            << (level + delta_l) << ". NaN in position {" << di << "," << dj
+                                                            << "} of the prediction stencil." << std::endl;
+                                              }
+                                          }
 #endif
-            }
+                                      });
             return result;
         }
 
@@ -648,29 +756,15 @@ namespace samurai
                           const typename Field::interval_t& jj)
         {
             using index_t = typename Field::interval_t::value_t;
-            static std::unordered_map<std::tuple<std::size_t, std::size_t, typename Field::interval_t, typename Field::interval_t>,
-                                      prediction_map<2, index_t>>
-                values;
-
-            auto iter = values.find({prediction_order, level, ii, jj});
 
-            if (iter == values.end())
-            {
-                for (auto ii_ = ii.start; ii_ < ii.end; ++ii_)
-                {
-                    for (auto jj_ = jj.start; jj_ < jj.end; ++jj_)
-                    {
-                        values[{prediction_order, level, ii, jj}] += prediction<prediction_order, index_t>(delta_l, ii_, jj_);
-                    }
-                }
-            }
             auto result = zeros_like(f(level, i, j));
 
-            for (const auto& kv : values[{prediction_order, level, ii, jj}].coeff)
-            {
-                // cppcheck-suppress useStlAlgorithm
-                result += kv.second * f(level, i + kv.first[0], j + kv.first[1]);
-            }
+            for_each_prediction_coeff(prediction_stencil_sum<prediction_order>(delta_l, ii).view(),
+                                      prediction_stencil_sum<prediction_order>(delta_l, jj).view(),
+                                      [&](index_t di, index_t dj, double coeff)
+                                      {
+                                          result += coeff * f(level, i + di, j + dj);
+                                      });
             return result;
         }
 
@@ -689,15 +783,15 @@ namespace samurai
         {
             using index_t = typename Field::interval_t::value_t;
 
-            auto pred = prediction<prediction_order, index_t>(delta_l, ii, jj, kk);
-
             auto result = zeros_like(f(element, level, i, j, k));
 
-            for (const auto& kv : pred.coeff)
-            {
-                // cppcheck-suppress useStlAlgorithm
-                result += kv.second * f(element, level, i + kv.first[0], j + kv.first[1], k + kv.first[2]);
-            }
+            for_each_prediction_coeff(prediction_stencil<prediction_order>(delta_l, ii),
+                                      prediction_stencil<prediction_order>(delta_l, jj),
+                                      prediction_stencil<prediction_order>(delta_l, kk),
+                                      [&](index_t di, index_t dj, index_t dk, double coeff)
+                                      {
+                                          result += coeff * f(element, level, i + di, j + dj, k + dk);
+                                      });
             return result;
         }
 
@@ -713,32 +807,17 @@ namespace samurai
                           const typename Field::interval_t& jj,
                           const typename Field::interval_t& kk)
         {
-            using index_t    = typename Field::interval_t::value_t;
-            using interval_t = typename Field::interval_t;
-            static std::unordered_map<std::tuple<std::size_t, std::size_t, interval_t, interval_t, interval_t>, prediction_map<3, index_t>> values;
-
-            auto iter = values.find({prediction_order, level, ii, jj, kk});
+            using index_t = typename Field::interval_t::value_t;
 
-            if (iter == values.end())
-            {
-                for (auto ii_ = ii.start; ii_ < ii.end; ++ii_)
-                {
-                    for (auto jj_ = jj.start; jj_ < jj.end; ++jj_)
-                    {
-                        for (auto kk_ = kk.start; kk_ < kk.end; ++kk_)
-                        {
-                            values[{prediction_order, level, ii, jj, kk}] += prediction<prediction_order, index_t>(delta_l, ii_, jj_, kk_);
-                        }
-                    }
-                }
-            }
             auto result = zeros_like(f(element, level, i, j, k));
 
-            for (const auto& kv : values[{prediction_order, level, ii, jj, kk}].coeff)
-            {
-                // cppcheck-suppress useStlAlgorithm
-                result += kv.second * f(element, level, i + kv.first[0], j + kv.first[1], k + kv.first[2]);
-            }
+            for_each_prediction_coeff(prediction_stencil_sum<prediction_order>(delta_l, ii).view(),
+                                      prediction_stencil_sum<prediction_order>(delta_l, jj).view(),
+                                      prediction_stencil_sum<prediction_order>(delta_l, kk).view(),
+                                      [&](index_t di, index_t dj, index_t dk, double coeff)
+                                      {
+                                          result += coeff * f(element, level, i + di, j + dj, k + dk);
+                                      });
             return result;
         }
 
@@ -754,15 +833,16 @@ namespace samurai
                           typename Field::interval_t::value_t kk)
         {
             using index_t = typename Field::interval_t::value_t;
-            auto pred     = prediction<prediction_order, index_t>(delta_l, ii, jj, kk);
 
             auto result = zeros_like(f(level, i, j, k));
 
-            for (const auto& kv : pred.coeff)
-            {
-                // cppcheck-suppress useStlAlgorithm
-                result += kv.second * f(level, i + kv.first[0], j + kv.first[1], k + kv.first[2]);
-            }
+            for_each_prediction_coeff(prediction_stencil<prediction_order>(delta_l, ii),
+                                      prediction_stencil<prediction_order>(delta_l, jj),
+                                      prediction_stencil<prediction_order>(delta_l, kk),
+                                      [&](index_t di, index_t dj, index_t dk, double coeff)
+                                      {
+                                          result += coeff * f(level, i + di, j + dj, k + dk);
+                                      });
             return result;
         }
 
@@ -777,32 +857,17 @@ namespace samurai
                           const typename Field::interval_t& jj,
                           const typename Field::interval_t& kk)
         {
-            using index_t    = typename Field::interval_t::value_t;
-            using interval_t = typename Field::interval_t;
-            static std::unordered_map<std::tuple<std::size_t, std::size_t, interval_t, interval_t, interval_t>, prediction_map<3, index_t>> values;
-
-            auto iter = values.find({prediction_order, level, ii, jj, kk});
+            using index_t = typename Field::interval_t::value_t;
 
-            if (iter == values.end())
-            {
-                for (auto ii_ = ii.start; ii_ < ii.end; ++ii_)
-                {
-                    for (auto jj_ = jj.start; jj_ < jj.end; ++jj_)
-                    {
-                        for (auto kk_ = kk.start; kk_ < kk.end; ++kk_)
-                        {
-                            values[{prediction_order, level, ii, jj, kk}] += prediction<prediction_order, index_t>(delta_l, ii_, jj_, kk_);
-                        }
-                    }
-                }
-            }
             auto result = zeros_like(f(level, i, j, k));
 
-            for (const auto& kv : values[{prediction_order, level, ii, jj, kk}].coeff)
-            {
-                // cppcheck-suppress useStlAlgorithm
-                result += kv.second * f(level, i + kv.first[0], j + kv.first[1], k + kv.first[2]);
-            }
+            for_each_prediction_coeff(prediction_stencil_sum<prediction_order>(delta_l, ii).view(),
+                                      prediction_stencil_sum<prediction_order>(delta_l, jj).view(),
+                                      prediction_stencil_sum<prediction_order>(delta_l, kk).view(),
+                                      [&](index_t di, index_t dj, index_t dk, double coeff)
+                                      {
+                                          result += coeff * f(level, i + di, j + dj, k + dk);
+                                      });
             return result;
         }
     }
@@ -7,6 +7,7 @@
 
 #include "fv/cell_based/cell_based_scheme__nonlin.hpp"
 #include "fv/cell_based/explicit_cell_based_scheme.hpp"
+#include "fv/cell_based/local_newton_solvers.hpp"
 #include "fv/explicit_operator_sum.hpp"
 #include "fv/flux_based/explicit_flux_based_scheme__lin_het.hpp"
 #include "fv/flux_based/explicit_flux_based_scheme__lin_hom.hpp"
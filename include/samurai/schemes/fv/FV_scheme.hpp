@@ -4,6 +4,7 @@
 #include "../../field.hpp"
 #include "../../static_algorithm.hpp"
 #include "../../timers.hpp"
+#include "stencil_filter.hpp"
 #include "utils.hpp"
 
 namespace samurai
@@ -129,6 +130,8 @@ namespace samurai
         std::array<directional_bdry_config_t, 2 * dim> m_dirichlet_config;
         std::array<directional_bdry_config_t, 2 * dim> m_neumann_config;
 
+        StencilFilter m_stencil_filter;
+
       public:
 
         FVScheme()
@@ -142,6 +145,19 @@ namespace samurai
             return m_name;
         }
 
+        /**
+         * Stencils processed by the explicit application (see apply_interior/apply_boundary)
+         */
+        StencilFilter& stencil_filter()
+        {
+            return m_stencil_filter;
+        }
+
+        const StencilFilter& stencil_filter() const
+        {
+            return m_stencil_filter;
+        }
+
         void set_name(const std::string& name)
         {
             m_name = name;
@@ -187,6 +203,54 @@ namespace samurai
             times::timers.stop(name() + " operator");
         }
 
+        /**
+         * Explicit application of the scheme into output_field, whose storage is reused
+         */
+        void apply_to(output_field_t& output_field, input_field_t& input_field)
+        {
+            times::timers.start(name() + " operator");
+            auto explicit_scheme = make_explicit(derived_cast());
+            explicit_scheme.apply_to(output_field, input_field);
+            times::timers.stop(name() + " operator");
+        }
+
+        /**
+         * Fused update result = input_field + a * scheme(input_field)
+         */
+        void axpy(output_field_t& result, input_field_t& input_field, field_value_type a)
+        {
+            times::timers.start(name() + " operator");
+            auto explicit_scheme = make_explicit(derived_cast());
+            explicit_scheme.axpy(result, input_field, a);
+            times::timers.stop(name() + " operator");
+        }
+
+        /**
+         * Split-phase explicit application, overlapping the ghost exchange:
+         *
+         *     start_ghost_update(u);
+         *     scheme.apply_interior(output_field, u);
+         *     finish_ghost_update(u);
+         *     scheme.apply_boundary(output_field, u);
+         *
+         * adds the same contributions to output_field as apply(output_field, u).
+         */
+        void apply_interior(output_field_t& output_field, input_field_t& input_field)
+        {
+            times::timers.start(name() + " operator");
+            auto explicit_scheme = make_explicit(derived_cast());
+            explicit_scheme.apply_interior(output_field, input_field);
+            times::timers.stop(name() + " operator");
+        }
+
+        void apply_boundary(output_field_t& output_field, input_field_t& input_field)
+        {
+            times::timers.start(name() + " operator");
+            auto explicit_scheme = make_explicit(derived_cast());
+            explicit_scheme.apply_boundary(output_field, input_field);
+            times::timers.stop(name() + " operator");
+        }
+
         auto operator()(std::size_t d, input_field_t& input_field)
         {
             times::timers.start(name() + " operator");
@@ -28,6 +28,8 @@ namespace samurai
       private:
 
         scheme_definition_t m_scheme_definition;
+        // Neighbour indices of the stencil, rebuilt when the mesh changes
+        mutable StencilConnectivity<mesh_t, cfg::stencil_size> m_connectivity;
 
       public:
 
@@ -81,8 +83,7 @@ namespace samurai
         template <class Func>
         void for_each_stencil_and_coeffs(input_field_t& field, Func&& apply_coeffs) const
         {
-            auto& mesh      = field.mesh();
-            auto stencil_it = make_stencil_iterator(mesh, stencil());
+            auto& mesh = field.mesh();
 
             for_each_level(mesh,
                            [&](std::size_t level)
@@ -91,7 +92,8 @@ namespace samurai
 
                                for_each_stencil(mesh,
                                                 level,
-                                                stencil_it,
+                                                stencil(),
+                                                m_connectivity,
                                                 [&](auto& stencil_cells)
                                                 {
                                                     apply_coeffs(stencil_cells, coeffs);
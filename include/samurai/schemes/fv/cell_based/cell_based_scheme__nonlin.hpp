@@ -33,6 +33,8 @@ namespace samurai
       private:
 
         scheme_definition_t m_scheme_definition;
+        // Neighbour indices of the stencil, rebuilt when the mesh changes
+        mutable StencilConnectivity<mesh_t, cfg::stencil_size> m_connectivity;
 
       public:
 
@@ -153,8 +155,13 @@ namespace samurai
         {
             for_each_stencil(field.mesh(),
                              stencil(),
+                             m_connectivity,
                              [&](auto& stencil_cells)
                              {
+                                 if (!this->stencil_filter().accept(stencil_cells))
+                                 {
+                                     return;
+                                 }
                                  if constexpr (cfg::stencil_size == 1)
                                  {
                                      auto contrib = contribution(stencil_cells[0], field);
@@ -41,6 +41,10 @@ namespace samurai
                 input_field,
                 [&](const auto& cells, const auto& coeffs)
                 {
+                    if (!this->scheme().stencil_filter().accept(cells))
+                    {
+                        return;
+                    }
                     for (size_type field_i = 0; field_i < output_n_comp; ++field_i)
                     {
                         for (size_type field_j = 0; field_j < n_comp; ++field_j)
@@ -0,0 +1,312 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+
+#include "../../../algorithm.hpp"
+#include "../../../timers.hpp"
+#include "cell_based_scheme__nonlin.hpp"
+
+namespace samurai
+{
+    namespace detail
+    {
+        /**
+         * Solves the dense system A*x = b of fixed size n by LU factorization with partial pivoting.
+         * A is overwritten by its factors and b by the solution.
+         * Returns false if A is singular.
+         */
+        template <class value_t, std::size_t n>
+        bool dense_lu_solve(std::array<std::array<value_t, n>, n>& A, std::array<value_t, n>& b)
+        {
+            for (std::size_t k = 0; k < n; ++k)
+            {
+                std::size_t pivot = k;
+                for (std::size_t i = k + 1; i < n; ++i)
+                {
+                    if (std::abs(A[i][k]) > std::abs(A[pivot][k]))
+                    {
+                        pivot = i;
+                    }
+                }
+                if (A[pivot][k] == 0)
+                {
+                    return false;
+                }
+                if (pivot != k)
+                {
+                    std::swap(A[pivot], A[k]);
+                    std::swap(b[pivot], b[k]);
+                }
+                for (std::size_t i = k + 1; i < n; ++i)
+                {
+                    A[i][k] /= A[k][k];
+                    for (std::size_t j = k + 1; j < n; ++j)
+                    {
+                        A[i][j] -= A[i][k] * A[k][j];
+                    }
+                    b[i] -= A[i][k] * b[k];
+                }
+            }
+            for (std::size_t k = n; k-- > 0;)
+            {
+                for (std::size_t j = k + 1; j < n; ++j)
+                {
+                    b[k] -= A[k][j] * b[j];
+                }
+                b[k] /= A[k][k];
+            }
+            return true;
+        }
+    }
+
+    /**
+     * Solves the independent non-linear systems of a local scheme (stencil of size 1): one system
+     * of size n_comp per cell, scheme(u)[cell] = rhs[cell], typically the implicit part of a stiff reaction.
+     *
+     * Each system is solved by Newton's method, with the Jacobian given by the local Jacobian function
+     * of the scheme, stored in a fixed-size dense matrix and factorized by LU. No PETSc object is involved,
+     * so that the cells are solved in parallel with OpenMP.
+     *
+     * The stopping criteria are those of the PETSc SNES defaults: the residual norm is below atol or
+     * rtol times the initial one, or the norm of the Newton step is below stol times the norm of the solution.
+     */
+    template <class Scheme>
+    class LocalNewtonSolvers
+    {
+        using scheme_t      = Scheme;
+        using field_t       = typename scheme_t::field_t;
+        using field_value_t = typename field_t::value_type;
+        using local_field_t = LocalField<field_t>;
+
+        static constexpr std::size_t n_comp = field_t::n_comp;
+
+        using vector_t = std::array<field_value_t, n_comp>;
+        using matrix_t = std::array<std::array<field_value_t, n_comp>, n_comp>;
+
+        static_assert(scheme_t::cfg_t::output_n_comp == n_comp);
+
+      protected:
+
+        field_t* m_unknown = nullptr;
+        scheme_t m_scheme;
+
+        double m_rtol                = 1e-8;
+        double m_atol                = 1e-50;
+        double m_stol                = 1e-8;
+        std::size_t m_max_iterations = 50;
+
+      public:
+
+        explicit LocalNewtonSolvers(const scheme_t& scheme)
+            : m_scheme(scheme)
+        {
+            if (!m_scheme.scheme_definition().local_scheme_function)
+            {
+                std::cerr << "The scheme function 'local_scheme_function' of operator '" << scheme.name() << "' has not been implemented."
+                          << std::endl;
+                assert(false && "Undefined 'local_scheme_function'");
+                exit(EXIT_FAILURE);
+            }
+            if (!m_scheme.scheme_definition().local_jacobian_function)
+            {
+                std::cerr << "The function 'local_jacobian_function' of operator '" << scheme.name() << "' has not been implemented."
+                          << std::endl;
+                assert(false && "Undefined 'local_jacobian_function'");
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        auto& scheme()
+        {
+            return m_scheme;
+        }
+
+        void set_unknown(field_t& u)
+        {
+            m_unknown = &u;
+        }
+
+        field_t& unknown()
+        {
+            return *m_unknown;
+        }
+
+        void set_tolerances(double rtol, double atol, double stol)
+        {
+            m_rtol = rtol;
+            m_atol = atol;
+            m_stol = stol;
+        }
+
+        void set_max_iterations(std::size_t max_iterations)
+        {
+            m_max_iterations = max_iterations;
+        }
+
+        void solve(const field_t& rhs)
+        {
+            if (!m_unknown)
+            {
+                std::cerr << "Undefined unknown for this non-linear system. Please set the unknowns using the instruction '[solver].set_unknown(u);'."
+                          << std::endl;
+                assert(false && "Undefined unknown");
+                exit(EXIT_FAILURE);
+            }
+
+#ifdef SAMURAI_WITH_OPENMP
+            static constexpr Run run_type = Run::Parallel;
+#else
+            static constexpr Run run_type = Run::Sequential;
+#endif
+            std::atomic<std::size_t> n_diverged = 0;
+
+            times::timers.start("local non-linear solves");
+            for_each_cell<run_type>(unknown().mesh(),
+                                    [&](auto& cell)
+                                    {
+                                        vector_t x;
+                                        vector_t b;
+                                        for (std::size_t c = 0; c < n_comp; ++c)
+                                        {
+                                            x[c] = component(unknown()[cell], c);
+                                            b[c] = component(rhs[cell], c);
+                                        }
+                                        if (!newton(cell, b, x))
+                                        {
+                                            ++n_diverged;
+                                        }
+                                        for (std::size_t c = 0; c < n_comp; ++c)
+                                        {
+                                            component(unknown()[cell], c) = x[c];
+                                        }
+                                    });
+            times::timers.stop("local non-linear solves");
+
+            if (n_diverged > 0)
+            {
+                std::cerr << "Divergence of the local non-linear solver in " << n_diverged.load() << " cell(s)" << std::endl;
+                assert(false && "Divergence of the solver");
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        void solve(field_t& unknown, const field_t& rhs)
+        {
+            set_unknown(unknown);
+            solve(rhs);
+        }
+
+      private:
+
+        template <class Value>
+        static decltype(auto) component(Value&& value, [[maybe_unused]] std::size_t c)
+        {
+            if constexpr (field_t::is_scalar)
+            {
+                return std::forward<Value>(value);
+            }
+            else
+            {
+                return value(c);
+            }
+        }
+
+        static double norm(const vector_t& v)
+        {
+            double norm2 = 0;
+            for (std::size_t c = 0; c < n_comp; ++c)
+            {
+                norm2 += static_cast<double>(v[c] * v[c]);
+            }
+            return std::sqrt(norm2);
+        }
+
+        /**
+         * r = scheme(x) - b in the cell
+         */
+        template <class Cell>
+        void residual(Cell& cell, const vector_t& b, const vector_t& x, vector_t& r) const
+        {
+            local_field_t x_field(cell, x.data());
+            auto value = m_scheme.local_scheme_function()(cell, x_field);
+            for (std::size_t c = 0; c < n_comp; ++c)
+            {
+                r[c] = component(value, c) - b[c];
+            }
+        }
+
+        template <class Cell>
+        void jacobian(Cell& cell, const vector_t& x, matrix_t& J) const
+        {
+            local_field_t x_field(cell, x.data());
+            auto jac_stencil_coeffs = m_scheme.local_jacobian_function()(cell, x_field);
+            auto& jac_coeffs        = jac_stencil_coeffs[0]; // local stencil (of size 1)
+            if constexpr (field_t::is_scalar)
+            {
+                J[0][0] = jac_coeffs;
+            }
+            else
+            {
+                for (std::size_t i = 0; i < n_comp; ++i)
+                {
+                    for (std::size_t j = 0; j < n_comp; ++j)
+                    {
+                        J[i][j] = jac_coeffs(i, j);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Newton's method in the cell, from the initial guess x. Returns false if it diverges.
+         */
+        template <class Cell>
+        bool newton(Cell& cell, const vector_t& b, vector_t& x) const
+        {
+            vector_t r;
+            matrix_t J;
+
+            residual(cell, b, x, r);
+            const double r0_norm = norm(r);
+            if (r0_norm <= m_atol)
+            {
+                return true;
+            }
+            for (std::size_t iteration = 0; iteration < m_max_iterations; ++iteration)
+            {
+                jacobian(cell, x, J);
+                // r becomes the Newton step
+                if (!detail::dense_lu_solve(J, r))
+                {
+                    return false;
+                }
+                for (std::size_t c = 0; c < n_comp; ++c)
+                {
+                    x[c] -= r[c];
+                }
+                const double step_norm = norm(r);
+
+                residual(cell, b, x, r);
+                const double r_norm = norm(r);
+                if (!std::isfinite(r_norm))
+                {
+                    return false;
+                }
+                if (r_norm <= m_atol || r_norm <= m_rtol * r0_norm || step_norm <= m_stol * norm(x))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    template <class cfg, class bdry_cfg, std::enable_if_t<cfg::scheme_type == SchemeType::NonLinear && cfg::stencil_size == 1, bool> = true>
+    auto make_local_newton_solvers(const CellBasedScheme<cfg, bdry_cfg>& scheme)
+    {
+        return LocalNewtonSolvers<CellBasedScheme<cfg, bdry_cfg>>(scheme);
+    }
+
+} // end namespace samurai
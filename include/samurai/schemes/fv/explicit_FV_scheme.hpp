@@ -1,4 +1,5 @@
 #pragma once
+#include "../../field_workspace.hpp"
 #include "../explicit_scheme.hpp"
 #include "FV_scheme.hpp"
 
@@ -16,6 +17,7 @@ namespace samurai
         using input_field_t  = typename scheme_t::input_field_t;
         using output_field_t = typename scheme_t::output_field_t;
         using size_type      = typename scheme_t::size_type;
+        using value_type     = typename output_field_t::value_type;
 
         static constexpr std::size_t dim = input_field_t::mesh_t::dim;
 
@@ -53,6 +55,20 @@ namespace samurai
             return output_field;
         }
 
+        /**
+         * Makes output_field live on the mesh of input_field.
+         * Its storage is only reallocated if its size does not match the mesh.
+         */
+        void prepare_output_field(output_field_t& output_field, input_field_t& input_field) const
+        {
+            auto& mesh = input_field.mesh();
+            output_field.change_mesh_ptr(mesh);
+            if (static_cast<std::size_t>(output_field.array().size()) != mesh.nb_cells() * output_field_t::n_comp)
+            {
+                output_field.resize();
+            }
+        }
+
       public:
 
         auto apply_to(input_field_t& input_field)
@@ -75,6 +91,65 @@ namespace samurai
             return output_field;
         }
 
+        /**
+         * Computes output_field = op(input_field), reusing the storage of output_field.
+         */
+        void apply_to(output_field_t& output_field, input_field_t& input_field)
+        {
+            prepare_output_field(output_field, input_field);
+            output_field.fill(0);
+            apply(output_field, input_field);
+        }
+
+        /**
+         * Computes result = input_field + a * op(input_field), e.g. an explicit Euler step with a = -dt.
+         * The value of the operator goes into a storage of the mesh workspace,
+         * then the update is done in a single pass: no allocation occurs once the workspace is warm.
+         * result can be input_field itself.
+         */
+        void axpy(output_field_t& result, input_field_t& input_field, value_type a)
+        {
+            static_assert(output_field_t::n_comp == input_field_t::n_comp,
+                          "axpy() requires an operator with the same number of components in input and output.");
+
+            WorkspaceField<output_field_t> op_value(input_field.mesh());
+            op_value.field().fill(0);
+            apply(op_value.field(), input_field);
+
+            prepare_output_field(result, input_field);
+            const auto* u = input_field.array().data();
+            const auto* f = op_value.field().array().data();
+            auto* r       = result.array().data();
+            const auto n  = static_cast<std::size_t>(input_field.array().size());
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                r[i] = u[i] + a * f[i];
+            }
+        }
+
+        /**
+         * Adds to output_field the contributions of the stencils which read no ghost value
+         * in flight (see start_ghost_update). The other ones must then be added by
+         * apply_boundary, once the ghost update is finished.
+         */
+        void apply_interior(output_field_t& output_field, input_field_t& input_field)
+        {
+            auto& filter = scheme().stencil_filter();
+            filter.set_pending_cells(input_field.mesh());
+            filter.select(StencilRegion::Interior);
+            apply(output_field, input_field);
+            filter.select(StencilRegion::All);
+        }
+
+        void apply_boundary(output_field_t& output_field, input_field_t& input_field)
+        {
+            auto& filter = scheme().stencil_filter();
+            filter.select(StencilRegion::Boundary);
+            apply(output_field, input_field);
+            filter.select(StencilRegion::All);
+            filter.clear_pending_cells(input_field.mesh());
+        }
+
         virtual void apply(output_field_t& output_field, input_field_t& input_field)
         {
             for (std::size_t d = 0; d < dim; ++d)
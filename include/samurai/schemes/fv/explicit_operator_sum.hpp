@@ -31,6 +31,24 @@ namespace samurai
                      });
         }
 
+        void apply_interior(output_field_t& output_field, input_field_t& input_field)
+        {
+            for_each(scheme().operators(),
+                     [&](auto& op)
+                     {
+                         op.apply_interior(output_field, input_field);
+                     });
+        }
+
+        void apply_boundary(output_field_t& output_field, input_field_t& input_field)
+        {
+            for_each(scheme().operators(),
+                     [&](auto& op)
+                     {
+                         op.apply_boundary(output_field, input_field);
+                     });
+        }
+
         void apply(std::size_t d, output_field_t& output_field, input_field_t& input_field) override
         {
             for_each(scheme().operators(),
@@ -72,6 +72,14 @@ namespace samurai
                 }
             });
 
+        if constexpr (cfg::scheme_type == SchemeType::NonLinear)
+        {
+            if (scalar != 1)
+            {
+                multiplied_scheme.drop_static_flux(); // the multiplied flux functions are type-erased
+            }
+        }
+
         multiplied_scheme.is_spd(scheme.is_spd() && scalar != 0);
         std::ostringstream name;
         if (scalar == static_cast<int>(scalar))
@@ -165,6 +173,11 @@ namespace samurai
                     }
                 }
             });
+
+        if constexpr (cfg::scheme_type == SchemeType::NonLinear)
+        {
+            sum_scheme.drop_static_flux(); // the summed flux functions are type-erased
+        }
         return sum_scheme;
     }
 
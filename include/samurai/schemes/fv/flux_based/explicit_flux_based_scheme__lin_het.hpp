@@ -52,6 +52,10 @@ namespace samurai
                 input_field,
                 [&](const auto& interface_cells, const auto& comput_cells, auto& left_cell_coeffs, auto& right_cell_coeffs)
                 {
+                    if (!this->scheme().stencil_filter().accept(comput_cells))
+                    {
+                        return;
+                    }
                     for (size_type field_i = 0; field_i < output_n_comp; ++field_i)
                     {
                         for (size_type field_j = 0; field_j < n_comp; ++field_j)
@@ -85,6 +89,10 @@ namespace samurai
                     input_field,
                     [&](const auto& cell, const auto& comput_cells, auto& coeffs)
                     {
+                        if (!this->scheme().stencil_filter().accept(comput_cells))
+                        {
+                            return;
+                        }
                         for (size_type field_i = 0; field_i < output_n_comp; ++field_i)
                         {
                             for (size_type field_j = 0; field_j < n_comp; ++field_j)
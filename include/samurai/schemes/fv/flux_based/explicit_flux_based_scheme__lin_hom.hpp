@@ -249,6 +249,10 @@ namespace samurai
                 input_field,
                 [&](auto& interface, auto& stencil, auto& left_cell_coeffs, auto& right_cell_coeffs)
                 {
+                    if (!this->scheme().stencil_filter().accept(stencil.cells(), interface.interval().size()))
+                    {
+                        return;
+                    }
 #ifdef SAMURAI_WITH_OPENMP
                     if (omp_get_max_threads() > 1)
                     {
@@ -276,6 +280,10 @@ namespace samurai
                     input_field,
                     [&](auto& cell, auto& stencil, auto& coeffs)
                     {
+                        if (!this->scheme().stencil_filter().accept(stencil.cells(), stencil.interval().size()))
+                        {
+                            return;
+                        }
                         for (size_type field_i = 0; field_i < output_n_comp; ++field_i)
                         {
                             for (size_type field_j = 0; field_j < n_comp; ++field_j)
@@ -33,23 +33,80 @@ namespace samurai
       private:
 
         template <bool enable_max_level_flux>
-        void _apply(std::size_t d, output_field_t& output_field, input_field_t& input_field)
+        void _apply_interior_binned(std::size_t d, output_field_t& output_field, input_field_t& input_field)
         {
-            // Interior interfaces
+            auto& bins = scheme().contribution_bins();
+#ifdef SAMURAI_WITH_OPENMP
+            bins.reset(static_cast<std::size_t>(omp_get_max_threads()), output_field.mesh().nb_cells());
+#else
+            bins.reset(1, output_field.mesh().nb_cells());
+#endif
+
+            // 1. Each thread stores its contributions in the bins of the owners of the cells
             scheme().template for_each_interior_interface<Run::Parallel, enable_max_level_flux>( // We need the 'template' keyword...
                 d,
                 input_field,
                 [&](const auto& cell, auto& contrib)
                 {
+#ifdef SAMURAI_WITH_OPENMP
+                    auto producer = static_cast<std::size_t>(omp_get_thread_num());
+#else
+                    std::size_t producer = 0;
+#endif
+                    auto b = bins.bin(producer, bins.owner(cell.index));
+                    bins.cell_indices[b].push_back(cell.index);
                     for (size_type field_i = 0; field_i < output_n_comp; ++field_i)
                     {
-                    // clang-format off
-                        #pragma omp atomic update
-                        field_value(output_field, cell, field_i) += this->scheme().flux_value_cmpnent(contrib, field_i);
-                        // clang-format on
+                        bins.values[b].push_back(this->scheme().flux_value_cmpnent(contrib, field_i));
                     }
                 });
 
+            // 2. Each owner adds the contributions to its cells, in the order of the producers
+            const auto n_threads = static_cast<std::ptrdiff_t>(bins.n_threads);
+#pragma omp parallel for schedule(static)
+            for (std::ptrdiff_t o = 0; o < n_threads; ++o)
+            {
+                for (std::size_t producer = 0; producer < bins.n_threads; ++producer)
+                {
+                    auto b             = bins.bin(producer, static_cast<std::size_t>(o));
+                    const auto& cells  = bins.cell_indices[b];
+                    const auto& values = bins.values[b];
+                    for (std::size_t c = 0; c < cells.size(); ++c)
+                    {
+                        for (size_type field_i = 0; field_i < output_n_comp; ++field_i)
+                        {
+                            field_value(output_field, cells[c], field_i) += values[c * output_n_comp + field_i];
+                        }
+                    }
+                }
+            }
+        }
+
+        template <bool enable_max_level_flux>
+        void _apply(std::size_t d, output_field_t& output_field, input_field_t& input_field)
+        {
+            // Interior interfaces
+            if (scheme().flux_accumulation() == FluxAccumulation::Binned)
+            {
+                _apply_interior_binned<enable_max_level_flux>(d, output_field, input_field);
+            }
+            else
+            {
+                scheme().template for_each_interior_interface<Run::Parallel, enable_max_level_flux>( // We need the 'template' keyword...
+                    d,
+                    input_field,
+                    [&](const auto& cell, auto& contrib)
+                    {
+                        for (size_type field_i = 0; field_i < output_n_comp; ++field_i)
+                        {
+                        // clang-format off
+                            #pragma omp atomic update
+                            field_value(output_field, cell, field_i) += this->scheme().flux_value_cmpnent(contrib, field_i);
+                            // clang-format on
+                        }
+                    });
+            }
+
             // Boundary interfaces
             if (scheme().include_boundary_fluxes())
             {
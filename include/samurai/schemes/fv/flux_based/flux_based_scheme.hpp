@@ -1,4 +1,6 @@
 #pragma once
+#include <optional>
+
 #include "../../../arguments.hpp"
 #include "../../../interface.hpp"
 #include "../../../reconstruction.hpp"
@@ -31,6 +33,57 @@ namespace samurai
         return FluxBasedScheme<cfg, bdry_cfg>(flux_definition);
     }
 
+    /**
+     * Non-linear scheme whose conservative flux function is stored with its concrete type,
+     * so that it is inlined in the loop over the interfaces instead of being called through a std::function.
+     * The flux function is called as
+     *
+     *            flux(flux_value, data, u)          or          flux(d, flux_value, data, u)
+     *
+     * if it depends on the direction d. The stencils and the Jacobian functions are taken from flux_definition.
+     * The composition of the scheme with the algebraic operators falls back to the type-erased path.
+     */
+    template <class cfg, class Flux>
+    auto make_flux_based_scheme(const FluxDefinition<cfg>& flux_definition, const Flux& flux)
+    {
+        static_assert(cfg::scheme_type == SchemeType::NonLinear, "Only non-linear schemes can have a static flux function.");
+
+        using static_cfg = StaticFluxConfig<cfg, Flux>;
+        using bdry_cfg   = BoundaryConfigFV<cfg::stencil_size / 2>;
+
+        // cppcheck-suppress knownConditionTrueFalse
+        if (args::enable_max_level_flux && cfg::dim > 1 && cfg::stencil_size > 4 && !args::refine_boundary)
+        {
+            std::cout << "Warning: for stencils larger than 4, computing fluxes at max_level may cause issues close to the boundary."
+                      << std::endl;
+        }
+
+        FluxDefinition<static_cfg> static_flux_definition;
+        for (std::size_t d = 0; d < cfg::dim; ++d)
+        {
+            static_flux_definition[d].direction              = flux_definition[d].direction;
+            static_flux_definition[d].stencil                = flux_definition[d].stencil;
+            static_flux_definition[d].cons_jacobian_function = flux_definition[d].cons_jacobian_function;
+            static_flux_definition[d].jacobian_function      = flux_definition[d].jacobian_function;
+            static_flux_definition[d].cons_flux_function =
+                [flux, d](FluxValue<cfg>& flux_value, const StencilData<cfg>& data, const StencilValues<cfg>& u)
+            {
+                detail::call_static_flux<cfg>(flux, d, flux_value, data, u);
+            };
+        }
+
+        return FluxBasedScheme<static_cfg, bdry_cfg>(static_flux_definition, flux);
+    }
+
+    /**
+     * Same as above, with the default centered stencils.
+     */
+    template <class cfg, class Flux>
+    auto make_flux_based_scheme(const Flux& flux)
+    {
+        return make_flux_based_scheme(FluxDefinition<cfg>(), flux);
+    }
+
     /**
      * is_FluxBasedScheme
      */
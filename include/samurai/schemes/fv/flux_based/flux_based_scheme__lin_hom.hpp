@@ -30,6 +30,10 @@ namespace samurai
         FluxDefinition<cfg> m_flux_definition;
         bool m_include_boundary_fluxes = true;
 
+        // Neighbour indices of the same-level interfaces, per direction, rebuilt when the mesh changes
+        mutable std::array<StencilConnectivity<mesh_t, 2>, dim> m_interface_connectivity;
+        mutable std::array<StencilConnectivity<mesh_t, cfg::stencil_size>, dim> m_comput_stencil_connectivity;
+
       public:
 
         explicit FluxBasedScheme(const FluxDefinition<cfg>& flux_definition)
@@ -91,6 +95,8 @@ namespace samurai
                     level,
                     flux_def.direction,
                     flux_def.stencil,
+                    m_interface_connectivity[d],
+                    m_comput_stencil_connectivity[d],
                     [&](auto& interface, auto& stencil)
                     {
                         apply_coeffs(interface, stencil, left_cell_coeffs, right_cell_coeffs);
@@ -35,11 +35,62 @@ namespace samurai
 
         static constexpr std::size_t stencil_size = cfg::stencil_size;
 
+        // Type of the flux function stored with its concrete type, if any (see StaticFluxConfig)
+        using static_flux_type = static_flux_t<cfg>;
+
+        /**
+         * Contributions to the output field stored per (producer thread, owner thread),
+         * used by the explicit scheme to accumulate the fluxes without atomic operations.
+         * The cells are distributed among the owners by contiguous blocks of indices.
+         * The vectors are kept from one application to the next to avoid reallocations.
+         */
+        struct ContributionBins
+        {
+            using cell_index_t = typename output_field_t::index_t;
+            using value_t      = typename output_field_t::value_type;
+
+            std::size_t n_threads = 1;
+            std::size_t n_cells   = 1;
+            std::vector<std::vector<cell_index_t>> cell_indices;
+            std::vector<std::vector<value_t>> values;
+
+            void reset(std::size_t nb_threads, std::size_t nb_cells)
+            {
+                n_threads = nb_threads;
+                n_cells   = std::max(nb_cells, std::size_t{1});
+                cell_indices.resize(n_threads * n_threads);
+                values.resize(n_threads * n_threads);
+                for (std::size_t b = 0; b < cell_indices.size(); ++b)
+                {
+                    cell_indices[b].clear();
+                    values[b].clear();
+                }
+            }
+
+            std::size_t owner(cell_index_t cell_index) const
+            {
+                return std::min(static_cast<std::size_t>(cell_index) * n_threads / n_cells, n_threads - 1);
+            }
+
+            std::size_t bin(std::size_t producer, std::size_t owner_thread) const
+            {
+                return producer * n_threads + owner_thread;
+            }
+        };
+
       private:
 
         FluxDefinition<cfg> m_flux_definition;
+        std::optional<static_flux_type> m_static_flux;
         bool m_include_boundary_fluxes = true;
         bool m_enable_max_level_flux   = false;
+        std::optional<FluxAccumulation> m_flux_accumulation; // if not set, args::flux_accumulation
+
+        // Neighbour indices of the same-level interfaces, per direction, rebuilt when the mesh changes
+        std::array<StencilConnectivity<mesh_t, 2>, dim> m_interface_connectivity;
+        std::array<StencilConnectivity<mesh_t, stencil_size>, dim> m_comput_stencil_connectivity;
+
+        ContributionBins m_contribution_bins;
 
       public:
 
@@ -48,6 +99,16 @@ namespace samurai
         {
         }
 
+        /**
+         * The conservative flux is computed by static_flux instead of the std::function of the flux definition,
+         * which must compute the same flux: it is used when the scheme is composed at runtime (see drop_static_flux()).
+         */
+        FluxBasedScheme(const FluxDefinition<cfg>& flux_definition, const static_flux_type& static_flux)
+            : m_flux_definition(flux_definition)
+            , m_static_flux(static_flux)
+        {
+        }
+
         const auto& flux_definition() const
         {
             return m_flux_definition;
@@ -83,6 +144,39 @@ namespace samurai
             return m_enable_max_level_flux;
         }
 
+        void flux_accumulation(FluxAccumulation accumulation)
+        {
+            m_flux_accumulation = accumulation;
+        }
+
+        /**
+         * Accumulation mode of the scheme: the one set by flux_accumulation(...), which takes precedence
+         * over the command line option --flux-accumulation, or else the latter.
+         */
+        FluxAccumulation flux_accumulation() const
+        {
+            return m_flux_accumulation.value_or(args::flux_accumulation);
+        }
+
+        auto& contribution_bins()
+        {
+            return m_contribution_bins;
+        }
+
+        bool has_static_flux() const
+        {
+            return m_static_flux.has_value();
+        }
+
+        /**
+         * Falls back to the std::function of the flux definition.
+         * Called by the algebraic operators, which compose the flux functions at runtime.
+         */
+        void drop_static_flux()
+        {
+            m_static_flux.reset();
+        }
+
       private:
 
         inline auto h_factor(double h_face, double h_cell) const
@@ -317,21 +411,27 @@ namespace samurai
         {
             std::vector<StencilValues<cfg>> stencil_values_list(flux_params.n_fine_fluxes);
             FluxValuePair<cfg> flux_values;
-            StencilData<cfg> data(comput_stencil_it.cells());
+            FluxStencilData<cfg> data(comput_stencil_it.cells());
 
             data.cell_length = flux_params.cell_length;
 
+            const auto& filter = this->stencil_filter();
+
             for (std::size_t ii = 0; ii < comput_stencil_it.interval().size(); ++ii)
             {
-                compute_stencil_values<enable_max_level_flux>(flux_params, comput_stencil_it.cells(), field, stencil_values_list);
-
-                for (std::size_t k = 0; k < flux_params.n_fine_fluxes; ++k)
+                // with the fluxes at max_level, the predictions read cells outside of the stencil
+                if (enable_max_level_flux ? filter.accept_unknown() : filter.accept(comput_stencil_it.cells()))
                 {
-                    flux_function(flux_values, data, stencil_values_list[k]);
-                    flux_values[0] *= flux_params.left_factor;
-                    flux_values[1] *= flux_params.right_factor;
-                    apply_contrib(interface_it.cells()[0], flux_values[0]);
-                    apply_contrib(interface_it.cells()[1], flux_values[1]);
+                    compute_stencil_values<enable_max_level_flux>(flux_params, comput_stencil_it.cells(), field, stencil_values_list);
+
+                    for (std::size_t k = 0; k < flux_params.n_fine_fluxes; ++k)
+                    {
+                        flux_function(flux_values, data, stencil_values_list[k]);
+                        flux_values[0] *= flux_params.left_factor;
+                        flux_values[1] *= flux_params.right_factor;
+                        apply_contrib(interface_it.cells()[0], flux_values[0]);
+                        apply_contrib(interface_it.cells()[1], flux_values[1]);
+                    }
                 }
 
                 interface_it.move_next();
@@ -351,24 +451,29 @@ namespace samurai
 
             FluxValuePair<cfg> flux_values;
             StencilValues<cfg> stencil_values;
-            StencilData<cfg> data(comput_stencil_it.cells());
+            FluxStencilData<cfg> data(comput_stencil_it.cells());
 
             data.cell_length = data.cells[0].length;
 
+            const auto& filter = this->stencil_filter();
+
             for (std::size_t ii = 0; ii < comput_stencil_it.interval().size(); ++ii)
             {
-                copy_stencil_values(field, data.cells, stencil_values);
-
-                flux_function(flux_values, data, stencil_values);
-                if constexpr (direction)
+                if (filter.accept(data.cells))
                 {
-                    flux_values[0] *= factor;
-                    apply_contrib(interface_it.cells()[0], flux_values[0]);
-                }
-                else // opposite direction
-                {
-                    flux_values[1] *= -factor;
-                    apply_contrib(interface_it.cells()[0], flux_values[1]);
+                    copy_stencil_values(field, data.cells, stencil_values);
+
+                    flux_function(flux_values, data, stencil_values);
+                    if constexpr (direction)
+                    {
+                        flux_values[0] *= factor;
+                        apply_contrib(interface_it.cells()[0], flux_values[0]);
+                    }
+                    else // opposite direction
+                    {
+                        flux_values[1] *= -factor;
+                        apply_contrib(interface_it.cells()[0], flux_values[1]);
+                    }
                 }
 
                 interface_it.move_next();
@@ -384,6 +489,64 @@ namespace samurai
          */
         template <Run run_type = Run::Sequential, bool enable_max_level_flux, class Func>
         void for_each_interior_interface(std::size_t d, input_field_t& field, Func&& apply_contrib)
+        {
+            visit_flux_function(d,
+                                [&](const auto& flux_function)
+                                {
+                                    _for_each_interior_interface<run_type, enable_max_level_flux>(d,
+                                                                                                  field,
+                                                                                                  flux_function,
+                                                                                                  std::forward<Func>(apply_contrib));
+                                });
+        }
+
+        /**
+         * This function is used in the Explicit class to iterate over the boundary interfaces
+         * in a specific direction and receive the contribution computed from the stencil.
+         */
+        template <Run run_type = Run::Sequential, bool enable_max_level_flux, class Func>
+        void for_each_boundary_interface(std::size_t d, input_field_t& field, Func&& apply_contrib)
+        {
+            visit_flux_function(d,
+                                [&](const auto& flux_function)
+                                {
+                                    _for_each_boundary_interface<run_type, enable_max_level_flux>(d,
+                                                                                                  field,
+                                                                                                  flux_function,
+                                                                                                  std::forward<Func>(apply_contrib));
+                                });
+        }
+
+      private:
+
+        /**
+         * Calls f with the non-conservative flux function of direction d:
+         * a lambda calling the static flux if there is one, the std::function of the flux definition otherwise.
+         */
+        template <class Func>
+        void visit_flux_function(std::size_t d, Func&& f) const
+        {
+            if constexpr (!std::is_same_v<static_flux_type, detail::no_static_flux>)
+            {
+                if (m_static_flux)
+                {
+                    const auto& static_flux = *m_static_flux;
+                    f(
+                        [&static_flux, d](FluxValuePair<cfg>& fluxes, const FluxStencilData<cfg>& data, const StencilValues<cfg>& values)
+                        {
+                            detail::call_static_flux<cfg>(static_flux, d, fluxes[0], data, values);
+                            fluxes[1] = -fluxes[0];
+                        });
+                    return;
+                }
+            }
+
+            auto& flux_def = flux_definition()[d];
+            f(flux_def.flux_function ? flux_def.flux_function : flux_def.flux_function_as_conservative());
+        }
+
+        template <Run run_type, bool enable_max_level_flux, class FluxFunction, class Func>
+        void _for_each_interior_interface(std::size_t d, input_field_t& field, const FluxFunction& flux_function, Func&& apply_contrib)
         {
             auto& mesh = field.mesh();
 
@@ -392,8 +555,6 @@ namespace samurai
 
             auto& flux_def = flux_definition()[d];
 
-            auto flux_function = flux_def.flux_function ? flux_def.flux_function : flux_def.flux_function_as_conservative();
-
             double h_max_level = mesh.cell_length(mesh.max_level());
 
             FluxParameters<enable_max_level_flux> flux_params;
@@ -416,6 +577,8 @@ namespace samurai
                                                                                   level,
                                                                                   flux_def.direction,
                                                                                   flux_def.stencil,
+                                                                                  m_interface_connectivity[d],
+                                                                                  m_comput_stencil_connectivity[d],
                                                                                   [&](auto& interface_it, auto& comput_stencil_it)
                                                                                   {
                                                                                       process_interior_interfaces<enable_max_level_flux>(
@@ -494,12 +657,8 @@ namespace samurai
             }
         }
 
-        /**
-         * This function is used in the Explicit class to iterate over the boundary interfaces
-         * in a specific direction and receive the contribution computed from the stencil.
-         */
-        template <Run run_type = Run::Sequential, bool enable_max_level_flux, class Func>
-        void for_each_boundary_interface(std::size_t d, input_field_t& field, Func&& apply_contrib)
+        template <Run run_type, bool enable_max_level_flux, class FluxFunction, class Func>
+        void _for_each_boundary_interface(std::size_t d, input_field_t& field, const FluxFunction& flux_function, Func&& apply_contrib)
         {
             auto& mesh = field.mesh();
 
@@ -510,8 +669,6 @@ namespace samurai
 
             auto& flux_def = flux_definition()[d];
 
-            auto flux_function = flux_def.flux_function ? flux_def.flux_function : flux_def.flux_function_as_conservative();
-
             for_each_level(mesh,
                            [&](auto level)
                            {
@@ -554,6 +711,8 @@ namespace samurai
                            });
         }
 
+      public:
+
         /**
          * This function is used in the Assembly class to iterate over the interior interfaces
          * and receive the Jacobian coefficients.
@@ -1,6 +1,7 @@
 #pragma once
 #include "../utils.hpp"
 #include <functional>
+#include <type_traits>
 
 namespace samurai
 {
@@ -83,6 +84,29 @@ namespace samurai
         }
     };
 
+    namespace detail
+    {
+        template <class cfg, class = void>
+        struct flux_config
+        {
+            using type = cfg;
+        };
+
+        template <class cfg>
+        struct flux_config<cfg, std::void_t<typename cfg::flux_cfg_t>>
+        {
+            using type = typename cfg::flux_cfg_t;
+        };
+    }
+
+    /**
+     * Stencil data received by the flux functions of a scheme of config cfg.
+     * It is StencilData<cfg>, except for a static flux (see StaticFluxConfig): the flux functions
+     * then receive the StencilData of the config they are written for.
+     */
+    template <class cfg>
+    using FluxStencilData = StencilData<typename detail::flux_config<cfg>::type>;
+
     /**
      * Specialization of @class NormalFluxDefinition.
      * Defines how to compute a NON-LINEAR normal flux.
@@ -92,8 +116,8 @@ namespace samurai
     {
         using field_t = typename cfg::input_field_t;
 
-        using flux_func = std::function<void(FluxValuePair<cfg>&, const StencilData<cfg>&, const StencilValues<cfg>&)>;  // non-conservative
-        using cons_flux_func = std::function<void(FluxValue<cfg>&, const StencilData<cfg>&, const StencilValues<cfg>&)>; // conservative
+        using flux_func = std::function<void(FluxValuePair<cfg>&, const FluxStencilData<cfg>&, const StencilValues<cfg>&)>;  // non-conservative
+        using cons_flux_func = std::function<void(FluxValue<cfg>&, const FluxStencilData<cfg>&, const StencilValues<cfg>&)>; // conservative
 
         using jacobian_func      = std::function<StencilJacobianPair<cfg>(StencilCells<cfg>&, const field_t&)>; // non-conservative
         using cons_jacobian_func = std::function<StencilJacobian<cfg>(StencilCells<cfg>&, const field_t&)>;     // conservative
@@ -157,6 +181,62 @@ namespace samurai
         }
     };
 
+    /**
+     * Config of a NON-LINEAR flux whose conservative flux function is stored in the scheme
+     * with its concrete type (see make_flux_based_scheme(flux)) instead of a std::function,
+     * so that it can be inlined in the loop over the interfaces.
+     */
+    template <class cfg, class StaticFlux>
+    struct StaticFluxConfig : cfg
+    {
+        static_assert(cfg::scheme_type == SchemeType::NonLinear, "Only non-linear fluxes can be static.");
+
+        using static_flux_t = StaticFlux;
+        using flux_cfg_t    = cfg; ///< config of the flux functions
+    };
+
+    namespace detail
+    {
+        struct no_static_flux
+        {
+        };
+
+        template <class cfg, class = void>
+        struct static_flux
+        {
+            using type = no_static_flux;
+        };
+
+        template <class cfg>
+        struct static_flux<cfg, std::void_t<typename cfg::static_flux_t>>
+        {
+            using type = typename cfg::static_flux_t;
+        };
+
+        /**
+         * Calls a static flux function, which either takes the direction as first argument or not.
+         */
+        template <class cfg, class StaticFlux>
+        inline void call_static_flux(const StaticFlux& flux,
+                                     [[maybe_unused]] std::size_t d,
+                                     FluxValue<cfg>& flux_value,
+                                     const FluxStencilData<cfg>& data,
+                                     const StencilValues<cfg>& values)
+        {
+            if constexpr (std::is_invocable_v<const StaticFlux&, FluxValue<cfg>&, const FluxStencilData<cfg>&, const StencilValues<cfg>&>)
+            {
+                flux(flux_value, data, values);
+            }
+            else
+            {
+                flux(d, flux_value, data, values);
+            }
+        }
+    }
+
+    template <class cfg>
+    using static_flux_t = typename detail::static_flux<cfg>::type;
+
     //----------------------------------//
     //                                  //
     //      Linear heterogeneous        //
@@ -147,6 +147,30 @@ namespace samurai
             auto explicit_scheme = make_explicit(*this);
             explicit_scheme.apply(output_field, input_field);
         }
+
+        void apply_to(output_field_t& output_field, input_field_t& input_field)
+        {
+            auto explicit_scheme = make_explicit(*this);
+            explicit_scheme.apply_to(output_field, input_field);
+        }
+
+        void axpy(output_field_t& result, input_field_t& input_field, typename output_field_t::value_type a)
+        {
+            auto explicit_scheme = make_explicit(*this);
+            explicit_scheme.axpy(result, input_field, a);
+        }
+
+        void apply_interior(output_field_t& output_field, input_field_t& input_field)
+        {
+            auto explicit_scheme = make_explicit(*this);
+            explicit_scheme.apply_interior(output_field, input_field);
+        }
+
+        void apply_boundary(output_field_t& output_field, input_field_t& input_field)
+        {
+            auto explicit_scheme = make_explicit(*this);
+            explicit_scheme.apply_boundary(output_field, input_field);
+        }
     };
 
     template <class... Operators>
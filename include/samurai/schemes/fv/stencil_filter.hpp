@@ -0,0 +1,144 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace samurai
+{
+    /**
+     * Stencils processed by an explicit scheme while ghost values are in flight (see start_ghost_update):
+     *  - All: every stencil;
+     *  - Interior: the stencils which read no ghost value in flight;
+     *  - Boundary: the other ones.
+     */
+    enum class StencilRegion
+    {
+        All,
+        Interior,
+        Boundary
+    };
+
+    /**
+     * Selects the stencils of a region, knowing the cells of the field storage whose values are in flight.
+     * With no cell in flight, all the stencils are interior.
+     */
+    class StencilFilter
+    {
+      public:
+
+        /**
+         * Marks the cells whose values are received by the pending ghost exchange of the mesh.
+         * The marks are stored in a buffer of the workspace of the mesh, given back by clear_pending_cells.
+         */
+        template <class Mesh>
+        void set_pending_cells(Mesh& mesh)
+        {
+            if (m_pending_prefix.empty())
+            {
+                mesh.field_workspace().acquire(mesh.version(), m_pending_prefix);
+            }
+            m_mesh_version = mesh.version();
+
+            m_pending_prefix.assign(mesh.nb_cells() + 1, 0);
+            mesh.halo_exchange_plan().for_each_pending_range(
+                [&](auto first, auto last)
+                {
+                    for (auto i = first; i < last; ++i)
+                    {
+                        m_pending_prefix[static_cast<std::size_t>(i) + 1] = 1;
+                    }
+                });
+            for (std::size_t i = 1; i < m_pending_prefix.size(); ++i)
+            {
+                m_pending_prefix[i] += m_pending_prefix[i - 1];
+            }
+        }
+
+        template <class Mesh>
+        void clear_pending_cells(Mesh& mesh)
+        {
+            if (!m_pending_prefix.empty())
+            {
+                mesh.field_workspace().release(m_mesh_version, m_pending_prefix);
+                m_pending_prefix = {};
+            }
+        }
+
+        void select(StencilRegion region)
+        {
+            m_region = region;
+        }
+
+        StencilRegion region() const
+        {
+            return m_region;
+        }
+
+        /**
+         * Returns true if the stencil made of the cells (or of a single cell) is in the selected region.
+         */
+        template <class Cells>
+        bool accept(const Cells& cells) const
+        {
+            return accept(cells, 1);
+        }
+
+        /**
+         * Same as above for the stencils of a whole interval: each cell of the stencil
+         * is the first of `length` consecutive cells of the field storage.
+         */
+        template <class Cells>
+        bool accept(const Cells& cells, std::size_t length) const
+        {
+            if (m_region == StencilRegion::All)
+            {
+                return true;
+            }
+            return reads_pending(cells, length) == (m_region == StencilRegion::Boundary);
+        }
+
+        /**
+         * For the stencils whose reads are not known: they are processed with the boundary ones.
+         */
+        bool accept_unknown() const
+        {
+            return m_region != StencilRegion::Interior;
+        }
+
+      private:
+
+        template <class Cells>
+        bool reads_pending(const Cells& cells, std::size_t length) const
+        {
+            if constexpr (requires { cells.index; })
+            {
+                return is_pending(static_cast<std::size_t>(cells.index), static_cast<std::size_t>(cells.index) + length);
+            }
+            else
+            {
+                return std::any_of(cells.begin(),
+                                   cells.end(),
+                                   [&](const auto& cell)
+                                   {
+                                       return is_pending(static_cast<std::size_t>(cell.index), static_cast<std::size_t>(cell.index) + length);
+                                   });
+            }
+        }
+
+        bool is_pending(std::size_t first, std::size_t last) const
+        {
+            if (m_pending_prefix.empty())
+            {
+                return false;
+            }
+            last = std::min(last, m_pending_prefix.size() - 1);
+            return first < last && m_pending_prefix[last] != m_pending_prefix[first];
+        }
+
+        StencilRegion m_region = StencilRegion::All;
+        // m_pending_prefix[i]: number of cells in flight among the cells [0, i) of the field storage
+        std::vector<std::size_t> m_pending_prefix;
+        std::size_t m_mesh_version = 0; // version of the mesh the cells of m_pending_prefix belong to
+    };
+}
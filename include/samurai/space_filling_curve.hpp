@@ -0,0 +1,269 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace samurai::sfc
+{
+    enum class Curve
+    {
+        Morton,
+        Hilbert
+    };
+
+    using key_type = std::uint64_t;
+
+    /**
+     * Interleaves the `bits` lowest bits of the coordinates, x[0] giving the most significant bit of each group.
+     */
+    template <std::size_t dim>
+    inline key_type interleave(const std::array<key_type, dim>& x, std::size_t bits)
+    {
+        key_type key = 0;
+        for (std::size_t b = bits; b-- > 0;)
+        {
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                key = (key << 1) | ((x[d] >> b) & 1);
+            }
+        }
+        return key;
+    }
+
+    template <std::size_t dim>
+    inline key_type morton_key(const std::array<key_type, dim>& x, std::size_t bits)
+    {
+        return interleave(x, bits);
+    }
+
+    /**
+     * Index of the point x on the Hilbert curve of order `bits`, computed with
+     * the transpose algorithm of J. Skilling ("Programming the Hilbert curve", 2004).
+     */
+    template <std::size_t dim>
+    inline key_type hilbert_key(std::array<key_type, dim> x, std::size_t bits)
+    {
+        if (bits == 0)
+        {
+            return 0;
+        }
+        const key_type m = key_type{1} << (bits - 1);
+
+        // Inverse undo
+        for (key_type q = m; q > 1; q >>= 1)
+        {
+            const key_type p = q - 1;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                if (x[d] & q)
+                {
+                    x[0] ^= p;
+                }
+                else
+                {
+                    const key_type t = (x[0] ^ x[d]) & p;
+                    x[0] ^= t;
+                    x[d] ^= t;
+                }
+            }
+        }
+
+        // Gray encode
+        for (std::size_t d = 1; d < dim; ++d)
+        {
+            x[d] ^= x[d - 1];
+        }
+        key_type t = 0;
+        for (key_type q = m; q > 1; q >>= 1)
+        {
+            if (x[dim - 1] & q)
+            {
+                t ^= q - 1;
+            }
+        }
+        for (std::size_t d = 0; d < dim; ++d)
+        {
+            x[d] ^= t;
+        }
+
+        return interleave(x, bits);
+    }
+
+    /**
+     * Maps the cells of any level to their position on a space-filling curve
+     * defined at a reference level over a bounding box of indices.
+     * A cell is located by its first child at the reference level: since the
+     * cells of a mesh do not overlap, two cells never share the same key, and
+     * the children of a cell are contiguous on the curve.
+     */
+    template <std::size_t dim, class value_t>
+    class CurveIndexer
+    {
+      public:
+
+        /**
+         * @param min_corner, max_corner: bounding box [min_corner, max_corner) of the indices at ref_level
+         */
+        CurveIndexer(Curve curve,
+                     std::size_t ref_level,
+                     const std::array<value_t, dim>& min_corner,
+                     const std::array<value_t, dim>& max_corner)
+            : m_curve(curve)
+            , m_ref_level(ref_level)
+            , m_min_corner(min_corner)
+        {
+            static constexpr std::size_t max_bits = 64 / dim;
+
+            value_t extent = 1;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                extent = std::max(extent, max_corner[d] - min_corner[d]);
+            }
+            while ((key_type{1} << m_bits) < static_cast<key_type>(extent))
+            {
+                ++m_bits;
+            }
+            // the keys are computed at a coarser level if the box does not fit
+            if (m_bits > max_bits)
+            {
+                m_shift = m_bits - max_bits;
+                m_bits  = max_bits;
+            }
+        }
+
+        template <class Indices>
+        key_type operator()(std::size_t level, const Indices& indices) const
+        {
+            std::array<key_type, dim> x;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                auto index = static_cast<value_t>(indices[d]);
+                index      = level <= m_ref_level ? index << (m_ref_level - level) : index >> (level - m_ref_level);
+                x[d]       = static_cast<key_type>(index - m_min_corner[d]) >> m_shift;
+            }
+            return m_curve == Curve::Hilbert ? hilbert_key(x, m_bits) : morton_key(x, m_bits);
+        }
+
+        /**
+         * Key of the cell (level, i, index), index being its indices in the directions y (and z).
+         */
+        template <class Index>
+        key_type operator()(std::size_t level, value_t i, const Index& index) const
+        {
+            std::array<value_t, dim> indices;
+            indices[0] = i;
+            for (std::size_t d = 1; d < dim; ++d)
+            {
+                indices[d] = static_cast<value_t>(index[d - 1]);
+            }
+            return operator()(level, indices);
+        }
+
+      private:
+
+        Curve m_curve;
+        std::size_t m_ref_level;
+        std::array<value_t, dim> m_min_corner;
+        std::size_t m_bits  = 0;
+        std::size_t m_shift = 0;
+    };
+
+    struct weighted_key
+    {
+        key_type key;
+        double weight;
+    };
+
+    /**
+     * Cuts the curve into n_parts pieces of (nearly) equal weight.
+     * Returns the n_parts + 1 splitters: part p gathers the keys in [splitters[p], splitters[p + 1]).
+     * The keys are sorted in place.
+     */
+    inline std::vector<key_type> split_curve(std::vector<weighted_key>& keys, std::size_t n_parts)
+    {
+        std::sort(keys.begin(),
+                  keys.end(),
+                  [](const auto& a, const auto& b)
+                  {
+                      return a.key < b.key;
+                  });
+
+        double total_weight = 0;
+        for (const auto& k : keys)
+        {
+            total_weight += k.weight;
+        }
+
+        std::vector<key_type> splitters(n_parts + 1, 0);
+        splitters[n_parts] = ~key_type{0};
+
+        // the part of a key is given by the weight accumulated before its middle
+        double cumulated_weight = 0;
+        std::size_t part        = 1;
+        for (const auto& k : keys)
+        {
+            double middle = cumulated_weight + 0.5 * k.weight;
+            while (part < n_parts && middle >= total_weight * static_cast<double>(part) / static_cast<double>(n_parts))
+            {
+                splitters[part] = k.key;
+                ++part;
+            }
+            cumulated_weight += k.weight;
+        }
+        for (; part < n_parts; ++part)
+        {
+            splitters[part] = splitters[n_parts];
+        }
+        return splitters;
+    }
+
+    /**
+     * Summarizes sorted keys by at most n_samples groups of consecutive keys of (nearly) equal weight,
+     * each group being represented by its first key and its total weight.
+     * Cutting the samples of one list with split_curve never separates the keys of a group. With the samples
+     * of several processes gathered, a splitter taken from another process can fall between the keys of a group:
+     * the keys are then assigned by part_of one by one, and the weight of a part is only balanced up to the weight
+     * of a group.
+     */
+    inline std::vector<weighted_key> sample_curve(const std::vector<weighted_key>& sorted_keys, std::size_t n_samples)
+    {
+        if (sorted_keys.size() <= n_samples)
+        {
+            return sorted_keys;
+        }
+
+        double total_weight = 0;
+        for (const auto& k : sorted_keys)
+        {
+            total_weight += k.weight;
+        }
+
+        std::vector<weighted_key> samples;
+        samples.reserve(n_samples);
+        double cumulated_weight = 0;
+        for (const auto& k : sorted_keys)
+        {
+            if (samples.empty()
+                || (samples.size() < n_samples
+                    && cumulated_weight >= total_weight * static_cast<double>(samples.size()) / static_cast<double>(n_samples)))
+            {
+                samples.push_back({k.key, 0.});
+            }
+            samples.back().weight += k.weight;
+            cumulated_weight += k.weight;
+        }
+        return samples;
+    }
+
+    inline std::size_t part_of(const std::vector<key_type>& splitters, key_type key)
+    {
+        auto it = std::upper_bound(splitters.begin(), splitters.end() - 1, key);
+        return static_cast<std::size_t>(it - splitters.begin()) - 1;
+    }
+}
@@ -1,4 +1,11 @@
 #pragma once
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "arguments.hpp"
 #include "indices.hpp"
 #include "static_algorithm.hpp"
 
@@ -540,9 +547,11 @@ namespace samurai
         static constexpr std::size_t dim          = Mesh::dim;
         static constexpr std::size_t stencil_size = stencil_size_;
         using mesh_t                              = Mesh;
+        using mesh_id_t                           = typename Mesh::mesh_id_t;
         using mesh_interval_t                     = typename Mesh::mesh_interval_t;
         using coord_index_t                       = typename Mesh::config::interval_t::coord_index_t;
         using cell_t                              = Cell<dim, typename Mesh::interval_t>;
+        using cell_index_t                        = typename cell_t::index_t;
 
       private:
 
@@ -550,6 +559,8 @@ namespace samurai
         const mesh_interval_t* m_mesh_interval = nullptr;
         const StencilAnalyzer<stencil_size, dim>& m_stencil_analyzer;
         std::array<cell_t, stencil_size> m_cells;
+        // Last positions found for each stencil cell: the next origin is usually close to the previous one.
+        std::array<find_hint_t<dim>, stencil_size> m_hints{};
 
       public:
 
@@ -569,25 +580,8 @@ namespace samurai
 
         void init(const mesh_interval_t& origin_mesh_interval)
         {
-            if (origin_mesh_interval.level != m_cells[0].level)
-            {
-                double length = m_mesh.cell_length(origin_mesh_interval.level);
-                for (cell_t& cell : m_cells)
-                {
-                    cell.level  = origin_mesh_interval.level;
-                    cell.length = length;
-                }
-            }
-            m_mesh_interval = &origin_mesh_interval;
-
-            // origin of the stencil
-            cell_t& origin_cell    = m_cells[m_stencil_analyzer.origin_index];
-            origin_cell.indices[0] = origin_mesh_interval.i.start;
-            for (unsigned int d = 0; d < dim - 1; ++d)
-            {
-                origin_cell.indices[d + 1] = origin_mesh_interval.index[d];
-            }
-            origin_cell.index = get_index_start(m_mesh, origin_mesh_interval);
+            cell_t& origin_cell = init_origin(origin_mesh_interval);
+            origin_cell.index   = get_index_start(m_mesh, origin_mesh_interval);
 #ifndef NDEBUG
             if (origin_cell.index > 0 && static_cast<std::size_t>(origin_cell.index) > m_mesh.nb_cells()) // nb_cells() is very costly
             {
@@ -605,11 +599,7 @@ namespace samurai
                     }
 
                     // Translate the coordinates according the direction d
-                    cell_t& cell = m_cells[i];
-                    for (unsigned int k = 0; k < dim; ++k)
-                    {
-                        cell.indices[k] = origin_cell.indices[k] + m_stencil_analyzer.stencil(i, k);
-                    }
+                    cell_t& cell = translate_from_origin(i);
 
                     // Find cell index
                     if (m_stencil_analyzer.same_row_as_origin[i])
@@ -619,24 +609,43 @@ namespace samurai
                     }
                     else
                     {
-                        DirectionVector<dim> dir;
-                        for (std::size_t k = 0; k < dim; ++k)
+                        const auto& lca = m_mesh[mesh_id_t::reference][origin_mesh_interval.level];
+                        auto offset     = find(lca, cell.indices, m_hints[i]);
+                        if (offset < 0)
                         {
-                            dir(k) = m_stencil_analyzer.stencil(i, k);
+                            DirectionVector<dim> dir;
+                            for (std::size_t k = 0; k < dim; ++k)
+                            {
+                                dir(k) = m_stencil_analyzer.stencil(i, k);
+                            }
+                            std::ostringstream message;
+                            message << "Non-existing neighbour for " << origin_cell << " in the direction " << dir;
+                            throw std::out_of_range(message.str());
                         }
-                        cell.index = get_index_start_translated(m_mesh, origin_mesh_interval, dir);
-#ifndef NDEBUG
-                        if (cell.index > 0 && static_cast<std::size_t>(cell.index) > m_mesh.nb_cells()) // nb_cells() is very costly
-                        {
-                            std::cout << "Non-existing neighbour for " << origin_cell << " in the direction " << dir << std::endl;
-                            assert(false);
-                        }
-#endif
+                        cell.index = lca[0][static_cast<std::size_t>(offset)].index + cell.indices[0];
                     }
                 }
             }
         }
 
+        /**
+         * Same as above, but the indices of the first cell of each stencil cell
+         * are given (see StencilConnectivity): no search in the mesh is performed.
+         */
+        void init(const mesh_interval_t& origin_mesh_interval, const cell_index_t* start_indices)
+        {
+            cell_t& origin_cell = init_origin(origin_mesh_interval);
+            origin_cell.index   = start_indices[m_stencil_analyzer.origin_index];
+            for (unsigned int i = 0; i < stencil_size; ++i)
+            {
+                if (i != m_stencil_analyzer.origin_index)
+                {
+                    cell_t& cell = translate_from_origin(i);
+                    cell.index   = start_indices[i];
+                }
+            }
+        }
+
         inline const auto& mesh() const
         {
             return m_mesh;
@@ -680,6 +689,42 @@ namespace samurai
                 ++cell.indices[0]; // increment x-coordinate
             }
         }
+
+      private:
+
+        cell_t& init_origin(const mesh_interval_t& origin_mesh_interval)
+        {
+            if (origin_mesh_interval.level != m_cells[0].level)
+            {
+                double length = m_mesh.cell_length(origin_mesh_interval.level);
+                for (cell_t& cell : m_cells)
+                {
+                    cell.level  = origin_mesh_interval.level;
+                    cell.length = length;
+                }
+            }
+            m_mesh_interval = &origin_mesh_interval;
+
+            // origin of the stencil
+            cell_t& origin_cell    = m_cells[m_stencil_analyzer.origin_index];
+            origin_cell.indices[0] = origin_mesh_interval.i.start;
+            for (unsigned int d = 0; d < dim - 1; ++d)
+            {
+                origin_cell.indices[d + 1] = origin_mesh_interval.index[d];
+            }
+            return origin_cell;
+        }
+
+        cell_t& translate_from_origin(std::size_t i)
+        {
+            const cell_t& origin_cell = m_cells[m_stencil_analyzer.origin_index];
+            cell_t& cell              = m_cells[i];
+            for (unsigned int k = 0; k < dim; ++k)
+            {
+                cell.indices[k] = origin_cell.indices[k] + m_stencil_analyzer.stencil(i, k);
+            }
+            return cell;
+        }
     };
 
     template <std::size_t index_coarse_cell, class Mesh, std::size_t stencil_size>
@@ -819,6 +864,250 @@ namespace samurai
         for_each_stencil(set, stencil_it, std::forward<Func>(f));
     }
 
+    /**
+     * Precomputed neighbour indices of a stencil.
+     *
+     * For each recorded mesh interval, the index of the first cell of every
+     * stencil cell is stored in a flat array, so that IteratorStencil can be
+     * initialized without any search in the mesh.
+     * The table is built level by level and is tied to the version of the mesh
+     * (see Mesh_base::version()): it must be rebuilt when the mesh changes,
+     * which is checked by is_up_to_date().
+     */
+    template <class Mesh, std::size_t stencil_size_>
+    class StencilConnectivity
+    {
+      public:
+
+        static constexpr std::size_t dim          = Mesh::dim;
+        static constexpr std::size_t stencil_size = stencil_size_;
+        using mesh_interval_t                     = typename Mesh::mesh_interval_t;
+        using value_t                             = typename Mesh::value_t;
+        using cell_index_t                        = typename IteratorStencil<Mesh, stencil_size>::cell_index_t;
+        using stencil_analyzer_t                  = StencilAnalyzer<stencil_size, dim>;
+
+      private:
+
+        struct LevelConnectivity
+        {
+            std::size_t mesh_version = 0; // 0: not built
+            std::vector<mesh_interval_t> mesh_intervals;
+            std::vector<cell_index_t> start_indices; // stencil_size indices per mesh interval
+        };
+
+        stencil_analyzer_t m_stencil;
+        std::array<LevelConnectivity, Mesh::max_refinement_level + 1> m_levels;
+
+      public:
+
+        StencilConnectivity()
+        {
+            m_stencil.stencil.fill(0);
+        }
+
+        const auto& stencil() const
+        {
+            return m_stencil;
+        }
+
+        bool is_up_to_date(const Mesh& mesh, std::size_t level, const stencil_analyzer_t& stencil) const
+        {
+            return m_levels[level].mesh_version == mesh.version() && m_stencil.stencil == stencil.stencil;
+        }
+
+        /**
+         * Clears the table of the level and ties it to the current version of the mesh.
+         * If the stencil has changed, all the levels are invalidated.
+         */
+        void reset(const Mesh& mesh, std::size_t level, const stencil_analyzer_t& stencil)
+        {
+            if (!(m_stencil.stencil == stencil.stencil))
+            {
+                m_stencil = stencil;
+                for (auto& l : m_levels)
+                {
+                    l.mesh_version = 0;
+                }
+            }
+            auto& data        = m_levels[level];
+            data.mesh_version = mesh.version();
+            data.mesh_intervals.clear();
+            data.start_indices.clear();
+        }
+
+        /**
+         * Appends the mesh interval to the table (the neighbours are searched in the mesh).
+         */
+        void add(const Mesh& mesh, const mesh_interval_t& mesh_interval)
+        {
+            auto& data = m_levels[mesh_interval.level];
+            IteratorStencil<Mesh, stencil_size> stencil_it(mesh, m_stencil);
+            stencil_it.init(mesh_interval);
+            data.mesh_intervals.push_back(mesh_interval);
+            for (const auto& cell : stencil_it.cells())
+            {
+                data.start_indices.push_back(cell.index);
+            }
+        }
+
+        std::size_t nb_intervals(std::size_t level) const
+        {
+            return m_levels[level].mesh_intervals.size();
+        }
+
+        const auto& mesh_interval(std::size_t level, std::size_t k) const
+        {
+            return m_levels[level].mesh_intervals[k];
+        }
+
+        /**
+         * Number of y-rows of the tiles in which the mesh intervals of the level should be
+         * traversed (see tile()), or 0 if the stencil only reads one z-plane or if dim < 3.
+         * The z-planes of a tile read by the stencil must fit in args::stencil_tile_bytes,
+         * the size of a row being estimated for a scalar field of doubles.
+         */
+        std::size_t rows_per_tile(std::size_t level) const
+        {
+            if constexpr (dim < 3)
+            {
+                return 0;
+            }
+            else
+            {
+                const auto& data = m_levels[level];
+
+                int z_min = m_stencil.stencil(0, dim - 1);
+                int z_max = z_min;
+                for (std::size_t s = 1; s < stencil_size; ++s)
+                {
+                    z_min = std::min(z_min, m_stencil.stencil(s, dim - 1));
+                    z_max = std::max(z_max, m_stencil.stencil(s, dim - 1));
+                }
+                auto n_planes = static_cast<std::size_t>(z_max - z_min + 1);
+                if (n_planes == 1 || args::stencil_tile_bytes == 0 || data.mesh_intervals.empty())
+                {
+                    return 0;
+                }
+
+                std::size_t n_cells = 0;
+                std::size_t n_rows  = 0;
+                for (std::size_t k = 0; k < data.mesh_intervals.size(); ++k)
+                {
+                    n_cells += data.mesh_intervals[k].i.size();
+                    if (k == 0 || data.mesh_intervals[k].index != data.mesh_intervals[k - 1].index)
+                    {
+                        ++n_rows;
+                    }
+                }
+                auto row_bytes = std::max<std::size_t>(1, n_cells * sizeof(double) / n_rows);
+                return std::max<std::size_t>(1, args::stencil_tile_bytes / (n_planes * row_bytes));
+            }
+        }
+
+        /**
+         * Reorders the mesh intervals of the level, recorded in the (z, y, x) order, by tiles:
+         * the y-rows are split into blocks of rows_per_tile rows, and each block is traversed in
+         * the (z, y, x) order. A stencil spanning several z-planes then reads the rows of a plane
+         * again while they are still in cache. Nothing is done if rows_per_tile is 0.
+         * Two tables holding the same mesh intervals are reordered in the same way.
+         */
+        void tile(std::size_t level, std::size_t rows_per_tile)
+        {
+            auto& data = m_levels[level];
+            if (rows_per_tile == 0)
+            {
+                return;
+            }
+
+            auto rows    = static_cast<value_t>(rows_per_tile);
+            auto tile_of = [&](std::size_t k)
+            {
+                auto y = data.mesh_intervals[k].index[0];
+                return y >= 0 ? y / rows : (y + 1) / rows - 1;
+            };
+            std::vector<std::size_t> order(data.mesh_intervals.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(),
+                             order.end(),
+                             [&](std::size_t k1, std::size_t k2)
+                             {
+                                 return tile_of(k1) < tile_of(k2);
+                             });
+
+            std::vector<mesh_interval_t> mesh_intervals;
+            std::vector<cell_index_t> start_indices;
+            mesh_intervals.reserve(order.size());
+            start_indices.reserve(data.start_indices.size());
+            for (auto k : order)
+            {
+                mesh_intervals.push_back(data.mesh_intervals[k]);
+                start_indices.insert(start_indices.end(),
+                                     data.start_indices.begin() + static_cast<std::ptrdiff_t>(k * stencil_size),
+                                     data.start_indices.begin() + static_cast<std::ptrdiff_t>((k + 1) * stencil_size));
+            }
+            data.mesh_intervals = std::move(mesh_intervals);
+            data.start_indices  = std::move(start_indices);
+        }
+
+        /**
+         * Initializes the stencil iterator on the k-th mesh interval recorded on the level.
+         */
+        void init(IteratorStencil<Mesh, stencil_size>& stencil_it, std::size_t level, std::size_t k) const
+        {
+            const auto& data = m_levels[level];
+            stencil_it.init(data.mesh_intervals[k], data.start_indices.data() + k * stencil_size);
+        }
+    };
+
+    /**
+     * Same as for_each_stencil(mesh, level, stencil_it, f), but the neighbour indices are read from
+     * @p connectivity, which is (re)built only if the mesh has changed since the last call.
+     */
+    template <class Mesh, std::size_t stencil_size, class Func>
+    inline void for_each_stencil(const Mesh& mesh,
+                                 std::size_t level,
+                                 const StencilAnalyzer<stencil_size, Mesh::dim>& stencil,
+                                 StencilConnectivity<Mesh, stencil_size>& connectivity,
+                                 Func&& f)
+    {
+        using mesh_id_t = typename Mesh::mesh_id_t;
+
+        if (!connectivity.is_up_to_date(mesh, level, stencil))
+        {
+            connectivity.reset(mesh, level, stencil);
+            for_each_meshinterval(mesh[mesh_id_t::cells][level],
+                                  [&](const auto& mesh_interval)
+                                  {
+                                      connectivity.add(mesh, mesh_interval);
+                                  });
+            connectivity.tile(level, connectivity.rows_per_tile(level));
+        }
+
+        auto stencil_it = make_stencil_iterator(mesh, stencil);
+        for (std::size_t k = 0; k < connectivity.nb_intervals(level); ++k)
+        {
+            connectivity.init(stencil_it, level, k);
+            for (std::size_t ii = 0; ii < connectivity.mesh_interval(level, k).i.size(); ++ii)
+            {
+                f(stencil_it.cells());
+                stencil_it.move_next();
+            }
+        }
+    }
+
+    template <class Mesh, std::size_t stencil_size, class Func>
+    inline void for_each_stencil(const Mesh& mesh,
+                                 const StencilAnalyzer<stencil_size, Mesh::dim>& stencil,
+                                 StencilConnectivity<Mesh, stencil_size>& connectivity,
+                                 Func&& f)
+    {
+        for_each_level(mesh,
+                       [&](std::size_t level)
+                       {
+                           for_each_stencil(mesh, level, stencil, connectivity, std::forward<Func>(f));
+                       });
+    }
+
     template <std::size_t index_coarse_cell, class Mesh, std::size_t stencil_size>
     auto make_leveljump_iterator(const IteratorStencil<Mesh, stencil_size>& fine_iterator, std::size_t direction_index)
     {
@@ -0,0 +1,265 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#ifdef SAMURAI_WITH_OPENMP
+#include <omp.h>
+#endif
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <xtensor/xfixed.hpp>
+
+#include "apply.hpp"
+
+namespace samurai
+{
+    namespace detail
+    {
+        /**
+         * Intervals of the set, with their coordinates in the other directions, in the order of the traversal.
+         */
+        template <class Set>
+        auto gather_intervals(Set& set)
+        {
+            constexpr std::size_t dim = std::decay_t<Set>::dim;
+            using interval_t          = typename std::decay_t<Set>::interval_t;
+            using index_t             = xt::xtensor_fixed<int, xt::xshape<dim - 1>>;
+
+            std::vector<std::pair<interval_t, index_t>> intervals;
+            apply(set,
+                  [&](const auto& i, const auto& index)
+                  {
+                      intervals.emplace_back(i, index);
+                  });
+            return intervals;
+        }
+
+        /**
+         * Values of the outermost coordinate (y in 2D, z in 3D) of the rows of the set, in increasing order.
+         * Only the outermost dimension of the set is traversed.
+         */
+        template <class Set>
+        auto outer_values(Set& set)
+        {
+            constexpr std::size_t dim = std::decay_t<Set>::dim;
+            using value_t             = typename std::decay_t<Set>::interval_t::value_t;
+
+            xt::xtensor_fixed<int, xt::xshape<dim - 1>> index;
+            std::vector<value_t> values;
+
+            auto outer_set      = set.template get_local_set<dim>(set.level(), index);
+            auto start_and_stop = set.template get_start_and_stop_function<dim>();
+            apply(outer_set,
+                  start_and_stop,
+                  [&](const auto& interval)
+                  {
+                      for (auto v = interval.start; v < interval.end; ++v)
+                      {
+                          values.push_back(v);
+                      }
+                      return false;
+                  });
+            return values;
+        }
+
+        /**
+         * Calls f(n) for n in [0, size) on the threads, the items being handed out grain by grain.
+         * An exception cannot leave a parallel region: the one thrown for the smallest n, if any, is rethrown afterwards.
+         */
+        template <class Func>
+        void parallel_for(std::size_t size, Func&& f, std::size_t grain = 16)
+        {
+            const auto n_items = static_cast<std::ptrdiff_t>(size);
+            const auto n_grain = static_cast<int>(grain);
+            std::exception_ptr error;
+            std::ptrdiff_t error_item = n_items;
+
+#pragma omp parallel for schedule(dynamic, n_grain)
+            for (std::ptrdiff_t n = 0; n < n_items; ++n)
+            {
+                try
+                {
+                    f(static_cast<std::size_t>(n));
+                }
+                catch (...)
+                {
+#pragma omp critical(samurai_parallel_for_error)
+                    {
+                        if (n < error_item)
+                        {
+                            error_item = n;
+                            error      = std::current_exception();
+                        }
+                    }
+                }
+            }
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        /**
+         * Color of a row such that two different rows of the same color are at least m rows apart in one direction.
+         */
+        template <class Index>
+        std::size_t row_color(const Index& index, int m)
+        {
+            std::size_t color = 0;
+            for (std::size_t d = index.size(); d-- > 0;)
+            {
+                color = color * static_cast<std::size_t>(m) + static_cast<std::size_t>(((index[d] % m) + m) % m);
+            }
+            return color;
+        }
+    }
+
+    /**
+     * Same as apply(set, func), the set being evaluated by the threads.
+     *
+     * The rows of the result are split into chunks of consecutive values of the outermost coordinate
+     * (y in 2D, z in 3D). Each chunk is traversed by its own copy of the set expression: the traversal
+     * state lives in the nodes of the expression, and the rows of a chunk are found directly in the
+     * LevelCellArrays through their offsets, without walking the rows before them.
+     *
+     * func is called concurrently for intervals of different chunks, and in the order of apply for the
+     * intervals of a chunk. In 1D, or with a single thread, the set is traversed by apply.
+     */
+    template <class Set, class Func>
+    void parallel_apply(Set&& global_set, Func&& func)
+    {
+        using set_t               = std::decay_t<Set>;
+        constexpr std::size_t dim = set_t::dim;
+
+        // several chunks per thread, since the rows of the result are not evenly filled
+        constexpr std::size_t chunks_per_thread = 4;
+
+#ifdef SAMURAI_WITH_OPENMP
+        const auto n_threads = static_cast<std::size_t>(omp_get_max_threads());
+#else
+        const std::size_t n_threads = 1;
+#endif
+
+        if constexpr (dim == 1)
+        {
+            apply(global_set, func);
+        }
+        else
+        {
+            if (n_threads == 1 || !global_set.exist())
+            {
+                apply(global_set, func);
+                return;
+            }
+
+            const auto values   = detail::outer_values(global_set);
+            const auto n_chunks = std::min(values.size(), chunks_per_thread * n_threads);
+
+            detail::parallel_for(
+                n_chunks,
+                [&](std::size_t c)
+                {
+                    set_t set = global_set;
+                    xt::xtensor_fixed<int, xt::xshape<dim - 1>> index;
+
+                    // sets the offsets of the outermost dimension, from which the rows are found
+                    set.template get_local_set<dim>(set.level(), index);
+
+                    auto chunk_func = [&](const auto& interval, const auto& yz)
+                    {
+                        func(interval, yz);
+                        return false;
+                    };
+                    for (std::size_t n = c * values.size() / n_chunks; n < (c + 1) * values.size() / n_chunks; ++n)
+                    {
+                        index[dim - 2] = static_cast<int>(values[n]);
+                        detail::apply_impl<dim - 1>(set, chunk_func, index);
+                    }
+                },
+                1);
+        }
+    }
+
+    /**
+     * Same as set.apply_op(op...), the intervals of the set being distributed among the threads.
+     *
+     * With width = 0, the operators must only write in the cells of their interval and in the cells
+     * above or below them (details, prediction, flags of the children, ...): the intervals are independent.
+     *
+     * With width > 0, the operators may also write in the neighbours of the cells of their interval, up to
+     * width cells away (keep_around_refine, enlarge, ...), and read those of the interval itself. The rows of
+     * the set are then processed by colors: two rows of the same color are more than 2 * width rows apart
+     * in one direction, so that the cells they write are different. The intervals of a row are processed
+     * in order by the same thread.
+     *
+     * Since the cells written at the same time are different, the result is the same as the one of apply_op
+     * whatever the number of threads.
+     */
+    template <std::size_t width = 0, class Set, class... ApplyOp>
+    void parallel_apply_op(Set&& set, ApplyOp&&... op)
+    {
+        constexpr std::size_t dim = std::decay_t<Set>::dim;
+
+        const auto level = set.level();
+
+        if constexpr (width == 0)
+        {
+            parallel_apply(set,
+                           [&](const auto& i, const auto& index)
+                           {
+                               (op(level, i, index), ...);
+                           });
+        }
+        else if constexpr (dim == 1)
+        {
+            set.apply_op(std::forward<ApplyOp>(op)...);
+        }
+        else
+        {
+            const auto intervals = detail::gather_intervals(set);
+            constexpr int m = 2 * static_cast<int>(width) + 1;
+
+            // rows[r]: first interval of the row r (the intervals of a row are consecutive in the traversal)
+            std::vector<std::size_t> rows;
+            for (std::size_t n = 0; n < intervals.size(); ++n)
+            {
+                if (n == 0 || intervals[n].second != intervals[n - 1].second)
+                {
+                    rows.push_back(n);
+                }
+            }
+            rows.push_back(intervals.size());
+
+            std::size_t n_colors = 1;
+            for (std::size_t d = 0; d < dim - 1; ++d)
+            {
+                n_colors *= static_cast<std::size_t>(m);
+            }
+            std::vector<std::vector<std::size_t>> rows_by_color(n_colors);
+            for (std::size_t r = 0; r + 1 < rows.size(); ++r)
+            {
+                rows_by_color[detail::row_color(intervals[rows[r]].second, m)].push_back(r);
+            }
+
+            for (const auto& color_rows : rows_by_color)
+            {
+                detail::parallel_for(color_rows.size(),
+                                     [&](std::size_t n)
+                                     {
+                                         const auto r = color_rows[n];
+                                         for (std::size_t k = rows[r]; k < rows[r + 1]; ++k)
+                                         {
+                                             (op(level, intervals[k].first, intervals[k].second), ...);
+                                         }
+                                     });
+            }
+        }
+    }
+}
@@ -0,0 +1,165 @@
+// Copyright 2018-2025 the samurai's authors
+// SPDX-License-Identifier:  BSD-3-Clause
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <xtensor/xfixed.hpp>
+
+#include "subset/apply.hpp"
+
+namespace samurai
+{
+    /**
+     * Result of a set expression, stored as the list of its intervals with their
+     * coordinates in the other directions, in the order of the traversal.
+     *
+     * It can be used in place of the expression (operator(), apply_op, level()),
+     * without any set algebra.
+     */
+    template <std::size_t dim_, class TInterval>
+    class MaterializedSubset
+    {
+      public:
+
+        static constexpr std::size_t dim = dim_;
+        using interval_t                 = TInterval;
+        using value_t                    = typename interval_t::value_t;
+        using index_t                    = xt::xtensor_fixed<value_t, xt::xshape<dim - 1>>;
+
+        MaterializedSubset() = default;
+
+        template <class Set>
+        explicit MaterializedSubset(Set&& set)
+            : m_level(set.level())
+        {
+            apply(set,
+                  [&](const auto& i, const auto& index)
+                  {
+                      m_intervals.emplace_back(i, index);
+                  });
+        }
+
+        std::size_t level() const
+        {
+            return m_level;
+        }
+
+        /// Number of intervals
+        std::size_t size() const
+        {
+            return m_intervals.size();
+        }
+
+        bool empty() const
+        {
+            return m_intervals.empty();
+        }
+
+        template <class Func>
+        void operator()(Func&& func) const
+        {
+            for (const auto& [i, index] : m_intervals)
+            {
+                func(i, index);
+            }
+        }
+
+        template <class... ApplyOp>
+        void apply_op(ApplyOp&&... op) const
+        {
+            for (const auto& [i, index] : m_intervals)
+            {
+                (op(m_level, i, index), ...);
+            }
+        }
+
+      private:
+
+        std::size_t m_level = 0;
+        std::vector<std::pair<interval_t, index_t>> m_intervals;
+    };
+
+    /**
+     * Identifier of a set expression in a SubsetCache: the name of the expression,
+     * the level of the result and the other parameters it depends on (direction, layer, ...).
+     */
+    struct subset_cache_key
+    {
+        std::string name;
+        std::size_t level;
+        std::vector<int> params = {};
+
+        auto operator<=>(const subset_cache_key&) const = default;
+    };
+
+    /**
+     * Materialized set expressions built from a mesh, reused as long as the mesh version is unchanged.
+     *
+     * The expressions rebuilt on every time step (projection and prediction ghosts, boundary
+     * regions, ...) only depend on the mesh: get() evaluates them once per mesh version,
+     * the following calls only traverse the stored intervals.
+     * The cache is not thread-safe: it must be used outside of parallel regions.
+     */
+    template <std::size_t dim, class TInterval>
+    class SubsetCache
+    {
+      public:
+
+        using materialized_t = MaterializedSubset<dim, TInterval>;
+
+        /**
+         * Materialized set of the key for the mesh version. make_set() returns the set
+         * expression: it is only called when the set is not stored for this version.
+         * All the sets of an older version are dropped.
+         */
+        template <class MakeSet>
+        const materialized_t& get(std::size_t mesh_version, subset_cache_key key, MakeSet&& make_set)
+        {
+            if (mesh_version != m_version)
+            {
+                m_entries.clear();
+                m_version = mesh_version;
+            }
+
+            auto it = m_entries.find(key);
+            if (it == m_entries.end())
+            {
+                it = m_entries.emplace(std::move(key), materialized_t(make_set())).first;
+            }
+            return it->second;
+        }
+
+        /// Number of stored sets
+        std::size_t size() const
+        {
+            return m_entries.size();
+        }
+
+        void clear()
+        {
+            m_entries.clear();
+            m_version = 0;
+        }
+
+      private:
+
+        std::size_t m_version = 0;
+        std::map<subset_cache_key, materialized_t> m_entries;
+    };
+
+    /**
+     * Materialized set of the key, evaluated by make_set() once per version of the mesh.
+     */
+    template <class Mesh, class MakeSet>
+    const auto& cached_subset(const Mesh& mesh, subset_cache_key key, MakeSet&& make_set)
+    {
+        return mesh.subset_cache().get(mesh.version(), std::move(key), std::forward<MakeSet>(make_set));
+    }
+}
@@ -13,6 +13,53 @@ import argparse
 def read_mesh(filename, ite=None):
     return h5py.File(filename + '.h5', 'r')['mesh']
 
+# corners of a cell in the order of the XDMF elements (Polyline, Quadrilateral, Hexahedron)
+elements = {
+    1: np.array([[0], [1]]),
+    2: np.array([[0, 0], [1, 0], [1, 1], [0, 1]]),
+    3: np.array([[0, 0, 0], [1, 0, 0], [1, 1, 0], [0, 1, 0], [0, 0, 1], [1, 0, 1], [1, 1, 1], [0, 1, 1]]),
+}
+
+def is_mesh(mesh):
+    """True if the group holds a mesh, False if it holds one group per rank."""
+    return 'points' in mesh or 'intervals' in mesh
+
+def decode_intervals(intervals):
+    """
+    Rebuild the points and the connectivity of the cells from the compact output
+    (one row (level, start, end, y, z) per x-interval).
+    The cells are in the same order as the values of the fields.
+    """
+    data = intervals[:]
+    origin_point = intervals.attrs['origin_point']
+    scaling_factor = intervals.attrs['scaling_factor']
+    dim = data.shape[1] - 2
+
+    sizes = data[:, 2] - data[:, 1]
+    rows = np.repeat(np.arange(data.shape[0]), sizes)
+    nb_cells = rows.size
+    first_cell = np.repeat(np.cumsum(sizes) - sizes, sizes)
+
+    indices = np.empty((nb_cells, dim))
+    indices[:, 0] = data[rows, 1] + np.arange(nb_cells) - first_cell
+    for d in range(1, dim):
+        indices[:, d] = data[rows, 2 + d]
+
+    length = scaling_factor / 2.**data[rows, 0]
+    corners = origin_point + indices * length[:, np.newaxis]
+
+    element = elements[dim]
+    points = np.zeros((nb_cells * element.shape[0], 3))
+    points[:, :dim] = (corners[:, np.newaxis, :] + element[np.newaxis, :, :] * length[:, np.newaxis, np.newaxis]).reshape(-1, dim)
+    connectivity = np.arange(points.shape[0]).reshape(nb_cells, element.shape[0])
+    return points, connectivity
+
+def mesh_geometry(mesh):
+    """Points and connectivity of the cells, saved explicitly or rebuilt from the intervals."""
+    if 'intervals' in mesh:
+        return decode_intervals(mesh['intervals'])
+    return mesh['points'][:], mesh['connectivity'][:]
+
 def scatter_plot(ax, points):
     return ax.scatter(points[:, 0], points[:, 1], marker='+')
 
@@ -34,7 +81,7 @@ class Plot:
         if args.field is None:
             ax = plt.subplot(111)
             mesh = read_mesh(filename)
-            if 'points' in mesh:
+            if is_mesh(mesh):
                 self.plot(ax, mesh)
             else:
                 for rank in mesh.keys():
@@ -46,7 +93,7 @@ class Plot:
                 ax = plt.subplot(1, len(args.field), i + 1)
                 mesh = read_mesh(filename)
 
-                if 'points' in mesh:
+                if is_mesh(mesh):
                     unknown_field = next((f for f in args.field if f not in mesh['fields']), None)
 
                     if unknown_field is not None:
@@ -66,8 +113,7 @@ class Plot:
                 self.ax.append(ax)
 
     def plot(self, ax, mesh, field=None, init=True):
-        points = mesh['points']
-        connectivity = mesh['connectivity']
+        points, connectivity = mesh_geometry(mesh)
 
         segments = np.zeros((connectivity.shape[0], 2, 2))
         segments[:, :, 0] = points[:][connectivity[:]][:, :, 0]
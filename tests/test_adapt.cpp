@@ -1,3 +1,7 @@
+#ifdef SAMURAI_WITH_OPENMP
+#include <omp.h>
+#endif
+
 #include <gtest/gtest.h>
 
 #include <samurai/field.hpp>
@@ -40,4 +44,73 @@ namespace samurai
         adapt(1e-4, 2);
         ::samurai::finalize();
     }
+
+    TYPED_TEST(adapt_test, parallel_apply_op)
+    {
+        static constexpr std::size_t dim = TypeParam::value;
+        using config                     = MRConfig<dim>;
+        using mesh_t                     = MRMesh<config>;
+        using mesh_id_t                  = typename mesh_t::mesh_id_t;
+
+        auto mesh = mesh_t({xt::zeros<double>({dim}), xt::ones<double>({dim})}, 3, 5);
+
+        // a cell out of 7 is tagged to be refined
+        auto tag = make_scalar_field<int>("tag", mesh, 0);
+        for_each_cell(mesh,
+                      [&](const auto& cell)
+                      {
+                          if (cell.index % 7 == 0)
+                          {
+                              tag[cell] = static_cast<int>(CellFlag::refine);
+                          }
+                      });
+        auto sequential_tag = tag;
+        auto parallel_tag   = tag;
+
+        for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+        {
+            auto set = intersection(mesh[mesh_id_t::cells][level], mesh[mesh_id_t::cells][level]);
+            set.apply_op(keep_around_refine(sequential_tag));
+            parallel_apply_op<1>(set, keep_around_refine(parallel_tag));
+        }
+
+        for_each_cell(mesh,
+                      [&](const auto& cell)
+                      {
+                          EXPECT_EQ(parallel_tag[cell], sequential_tag[cell]);
+                      });
+    }
+
+    TYPED_TEST(adapt_test, deterministic)
+    {
+        static constexpr std::size_t dim = TypeParam::value;
+        using config                     = MRConfig<dim>;
+        using mesh_t                     = MRMesh<config>;
+
+        auto adapted_mesh = []()
+        {
+            auto mesh = mesh_t({xt::zeros<double>({dim}), xt::ones<double>({dim})}, 2, 6);
+            auto u    = make_scalar_field<double>("u",
+                                               mesh,
+                                               [](const auto& x)
+                                               {
+                                                   return xt::sum(x)() < 0.3 * static_cast<double>(dim) ? 1. : 0.;
+                                               });
+            auto adapt = make_MRAdapt(u);
+            adapt(1e-4, 2);
+            return mesh;
+        };
+
+#ifdef SAMURAI_WITH_OPENMP
+        const int n_threads = omp_get_max_threads();
+        omp_set_num_threads(1);
+        auto sequential_mesh = adapted_mesh();
+        omp_set_num_threads(n_threads);
+#else
+        auto sequential_mesh = adapted_mesh();
+#endif
+        auto parallel_mesh = adapted_mesh();
+
+        EXPECT_TRUE(sequential_mesh == parallel_mesh);
+    }
 }
@@ -2,9 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <samurai/bc.hpp>
 #include <samurai/box.hpp>
 #include <samurai/field.hpp>
 #include <samurai/mr/mesh.hpp>
+#include <samurai/schemes/fv.hpp>
 #include <samurai/uniform_mesh.hpp>
 
 namespace samurai
@@ -140,4 +142,66 @@ namespace samurai
         u.name() = "new_name";
         EXPECT_EQ(u.name(), "new_name");
     }
+
+    TEST(field, workspace)
+    {
+        Box<double, 1> box{{0}, {1}};
+        using Config = MRConfig<1>;
+        auto mesh    = MRMesh<Config>(box, 2, 4);
+
+        using scalar_t = decltype(make_scalar_field<double>("u", mesh));
+        using vector_t = decltype(make_vector_field<double, 2>("v", mesh));
+
+        const double* data = nullptr;
+        {
+            WorkspaceField<scalar_t> tmp(mesh);
+            EXPECT_EQ(static_cast<std::size_t>(tmp.field().array().size()), mesh.nb_cells());
+            data = tmp.field().array().data();
+        }
+        EXPECT_EQ(mesh.field_workspace().size(), 1u);
+        {
+            WorkspaceField<scalar_t> tmp(mesh);
+            EXPECT_EQ(tmp.field().array().data(), data);
+
+            WorkspaceField<vector_t> tmp_vec(mesh);
+            EXPECT_EQ(static_cast<std::size_t>(tmp_vec.field().array().size()), 2 * mesh.nb_cells());
+        }
+        EXPECT_EQ(mesh.field_workspace().size(), 2u);
+    }
+
+    TEST(field, operator_apply_to_and_axpy)
+    {
+        Box<double, 1> box{{0}, {1}};
+        using Config = MRConfig<1>;
+        auto mesh    = MRMesh<Config>(box, 4, 4);
+
+        auto u = make_scalar_field<double>("u", mesh, 0.);
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          u[cell] = cell.center(0) * (1 - cell.center(0));
+                      });
+        make_bc<Dirichlet<1>>(u, 0.);
+
+        auto diff   = make_diffusion_order2<decltype(u)>();
+        double dt   = 0.01;
+        auto diff_u = make_scalar_field<double>("diff_u", mesh, 1.);
+        diff.apply_to(diff_u, u);
+        diff.apply_to(diff_u, u); // the previous values are overwritten
+        auto ref = diff(u);
+
+        auto unp1 = make_scalar_field<double>("unp1", mesh, 0.);
+        diff.axpy(unp1, u, -dt);
+
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          EXPECT_DOUBLE_EQ(diff_u[cell], ref[cell]);
+                          EXPECT_DOUBLE_EQ(unp1[cell], u[cell] - dt * ref[cell]);
+                      });
+
+        auto n_buffers = mesh.field_workspace().size();
+        diff.axpy(unp1, u, -dt);
+        EXPECT_EQ(mesh.field_workspace().size(), n_buffers);
+    }
 }
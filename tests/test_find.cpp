@@ -41,4 +41,45 @@ namespace samurai
         EXPECT_TRUE(static_cast<std::size_t>(cell.index) < mesh.nb_cells());                      // cell index makes sense
         EXPECT_TRUE(xt::all(cell.corner() <= coords && coords <= (cell.corner() + cell.length))); // coords in cell
     }
+
+    TEST(find, methods)
+    {
+        static constexpr std::size_t dim = 2;
+        using Config                     = samurai::MRConfig<dim>;
+        using Box                        = samurai::Box<double, dim>;
+        using Mesh                       = samurai::MRMesh<Config>;
+        using mesh_id_t                  = typename Mesh::mesh_id_t;
+
+        Box box({-1., -1.}, {1., 1.});
+        Mesh mesh{box, 2, 6};
+
+        auto u = samurai::make_scalar_field<double>("u",
+                                                    mesh,
+                                                    [](const auto& coords)
+                                                    {
+                                                        const auto& x = coords(0);
+                                                        const auto& y = coords(1);
+                                                        return (x * x + y * y < 0.25) ? 1. : 0.;
+                                                    });
+
+        auto MRadaptation = samurai::make_MRAdapt(u);
+        MRadaptation(1e-3, 1);
+
+        samurai::find_hint_t<dim> hint{};
+        for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+        {
+            const auto& lca = mesh[mesh_id_t::reference][level];
+            int bound       = 1 << (level + 1);
+            xt::xtensor_fixed<int, xt::xshape<dim>> coord;
+            for (coord[1] = -bound; coord[1] < bound; ++coord[1])
+            {
+                for (coord[0] = -bound; coord[0] < bound; ++coord[0])
+                {
+                    auto expected = samurai::find<samurai::FindMethod::Linear>(lca, coord);
+                    EXPECT_EQ(samurai::find<samurai::FindMethod::Binary>(lca, coord), expected);
+                    EXPECT_EQ(samurai::find(lca, coord, hint), expected);
+                }
+            }
+        }
+    }
 }
@@ -0,0 +1,231 @@
+#include <cmath>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include <samurai/algorithm/update.hpp>
+#include <samurai/bc.hpp>
+#include <samurai/field.hpp>
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/schemes/fv.hpp>
+
+namespace samurai
+{
+    TEST(flux_based_scheme, static_flux)
+    {
+        static constexpr std::size_t dim = 2;
+        using Config                     = MRConfig<dim>;
+
+        Box<double, dim> box({-1., -1.}, {1., 1.});
+        auto mesh = MRMesh<Config>(box, 2, 4);
+
+        auto u = make_vector_field<double, dim>("u", mesh, 0.);
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          for (std::size_t d = 0; d < dim; ++d)
+                          {
+                              u[cell][d] = cell.center(d) * cell.center(d) < 0.25 ? 1. : -0.5;
+                          }
+                      });
+        make_bc<Dirichlet<1>>(u, 0., 0.);
+        update_ghost_mr(u);
+
+        using field_t = decltype(u);
+        using cfg     = FluxConfig<SchemeType::NonLinear, dim, 2, field_t>;
+
+        // Upwind Burgers flux, written once for all directions
+        auto burgers_flux = [](std::size_t d, FluxValue<cfg>& flux, const StencilData<cfg>& /* data */, const StencilValues<cfg>& v)
+        {
+            if (v[0](d) >= 0)
+            {
+                flux = v[0](d) * v[0];
+            }
+            else
+            {
+                flux = v[1](d) * v[1];
+            }
+        };
+
+        FluxDefinition<cfg> type_erased_flux;
+        for (std::size_t d = 0; d < dim; ++d)
+        {
+            type_erased_flux[d].cons_flux_function = [burgers_flux, d](auto& flux, const auto& data, const auto& v)
+            {
+                burgers_flux(d, flux, data, v);
+            };
+        }
+
+        auto type_erased = make_flux_based_scheme(type_erased_flux);
+        auto static_flux = make_flux_based_scheme<cfg>(burgers_flux);
+        EXPECT_TRUE(static_flux.has_static_flux());
+
+        // the flux functions of the static scheme receive the StencilData of the config they are written for
+        using static_cfg = typename decltype(static_flux)::cfg_t;
+        static_assert(std::is_same_v<FluxStencilData<cfg>, StencilData<cfg>>);
+        static_assert(std::is_same_v<FluxStencilData<static_cfg>, StencilData<cfg>>);
+
+        auto expected = type_erased(u);
+        auto actual   = static_flux(u);
+
+        auto scaled_expected = (2. * type_erased)(u);
+        auto scaled_scheme   = 2. * static_flux;
+        EXPECT_FALSE(scaled_scheme.has_static_flux());
+        auto scaled_actual = scaled_scheme(u);
+
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          for (std::size_t d = 0; d < dim; ++d)
+                          {
+                              EXPECT_DOUBLE_EQ(actual[cell][d], expected[cell][d]);
+                              EXPECT_DOUBLE_EQ(scaled_actual[cell][d], scaled_expected[cell][d]);
+                          }
+                      });
+    }
+
+    TEST(flux_based_scheme, binned_accumulation)
+    {
+        static constexpr std::size_t dim = 2;
+        using Config                     = MRConfig<dim>;
+
+        Box<double, dim> box({-1., -1.}, {1., 1.});
+        auto mesh = MRMesh<Config>(box, 2, 6);
+
+        auto u = make_vector_field<double, dim>("u", mesh);
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          double r2  = cell.center(0) * cell.center(0) + cell.center(1) * cell.center(1);
+                          u[cell][0] = std::exp(-20 * r2);
+                          u[cell][1] = 1 - std::exp(-20 * r2);
+                      });
+        make_bc<Dirichlet<1>>(u, 0., 1.);
+
+        // multi-level mesh: the fluxes cross level jumps
+        auto MRadaptation = make_MRAdapt(u);
+        MRadaptation(1e-3, 1.);
+        ASSERT_LT(mesh.min_level(), mesh.max_level());
+        update_ghost_mr(u);
+
+        auto conv = make_convection_upwind<decltype(u)>();
+
+        conv.flux_accumulation(FluxAccumulation::Atomic);
+        auto atomic = conv(u);
+
+        conv.flux_accumulation(FluxAccumulation::Binned);
+        auto binned = conv(u);
+
+        // the setting of the scheme takes precedence over the command line option
+        args::flux_accumulation = FluxAccumulation::Binned;
+        EXPECT_EQ(make_convection_upwind<decltype(u)>().flux_accumulation(), FluxAccumulation::Binned);
+        conv.flux_accumulation(FluxAccumulation::Atomic);
+        EXPECT_EQ(conv.flux_accumulation(), FluxAccumulation::Atomic);
+        args::flux_accumulation = FluxAccumulation::Atomic;
+
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          for (std::size_t d = 0; d < dim; ++d)
+                          {
+                              EXPECT_NEAR(binned[cell][d], atomic[cell][d], 1e-12 * (1 + std::abs(atomic[cell][d])));
+                          }
+                      });
+    }
+
+    TEST(flux_based_scheme, apply_interior_and_boundary)
+    {
+        Box<double, 1> box{{0}, {1}};
+        using Config = MRConfig<1>;
+        auto mesh    = MRMesh<Config>(box, 2, 4);
+
+        auto u = make_scalar_field<double>("u", mesh, 0.);
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          u[cell] = cell.center(0) * (1 - cell.center(0));
+                      });
+        make_bc<Dirichlet<1>>(u, 0.);
+
+        auto diff = make_diffusion_order2<decltype(u)>();
+        update_ghost_mr(u);
+        auto ref = diff(u);
+
+        auto diff_u = make_scalar_field<double>("diff_u", mesh, 0.);
+        start_ghost_update(u);
+        diff.apply_interior(diff_u, u);
+        finish_ghost_update(u);
+        diff.apply_boundary(diff_u, u);
+
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          EXPECT_DOUBLE_EQ(diff_u[cell], ref[cell]);
+                      });
+    }
+
+    TEST(flux_based_scheme, apply_with_pending_ghosts)
+    {
+        Box<double, 1> box{{0}, {1}};
+        using Config = MRConfig<1>;
+        auto mesh    = MRMesh<Config>(box, 2, 4);
+
+        auto u = make_scalar_field<double>("u", mesh, 0.);
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          u[cell] = cell.center(0) * (1 - cell.center(0));
+                      });
+        make_bc<Dirichlet<1>>(u, 0.);
+
+        auto diff = make_diffusion_order2<decltype(u)>();
+        update_ghost_mr(u);
+        auto ref = diff(u);
+
+        // pretend that the values of the cells 4 and 5 of level 4 are received from a neighbouring subdomain
+        using plan_t            = std::decay_t<decltype(mesh.halo_exchange_plan())>;
+        auto& plan              = mesh.halo_exchange_plan();
+        auto first_pending_cell = mesh.get_cell(4, 4);
+        typename plan_t::neighbour_plan neighbour;
+        neighbour.rank = 1;
+        neighbour.recv.ranges.push_back({first_pending_cell.index, 2});
+        neighbour.recv.level_offsets  = {0, 0, 0, 0, 0, 1};
+        neighbour.recv.corner_offsets = {0, 0, 0, 0, 1};
+        plan.neighbours.push_back(neighbour);
+        plan.pending.active    = true;
+        plan.pending.min_level = 4;
+        plan.pending.max_level = 4;
+
+        auto diff_u = make_scalar_field<double>("diff_u", mesh, 0.);
+        diff.apply_interior(diff_u, u);
+
+        // the stencils reading a pending value are left to apply_boundary
+        std::size_t n_incomplete = 0;
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          if (diff_u[cell] != ref[cell])
+                          {
+                              ++n_incomplete;
+                          }
+                      });
+        EXPECT_GT(n_incomplete, 0u);
+
+        plan.pending.active = false;
+        diff.apply_boundary(diff_u, u);
+        plan.neighbours.clear();
+
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          EXPECT_DOUBLE_EQ(diff_u[cell], ref[cell]);
+                      });
+
+        // the buffer of the pending cells is recycled by the workspace of the mesh
+        auto n_buffers = mesh.field_workspace().size();
+        diff.apply_interior(diff_u, u);
+        diff.apply_boundary(diff_u, u);
+        EXPECT_EQ(mesh.field_workspace().size(), n_buffers);
+    }
+}
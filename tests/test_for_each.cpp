@@ -1,5 +1,16 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <samurai/amr/mesh.hpp>
+#include <samurai/bc.hpp>
+#include <samurai/field.hpp>
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/stencil.hpp>
 
 namespace samurai
 {
@@ -83,4 +94,182 @@ namespace samurai
                       });
         EXPECT_EQ(nb_cells, 2);
     }
+
+    TEST(stencil, connectivity)
+    {
+        static constexpr std::size_t dim = 2;
+        using Config                     = MRConfig<dim>;
+        using Mesh                       = MRMesh<Config>;
+        using mesh_id_t                  = typename Mesh::mesh_id_t;
+        using cl_type                    = typename Mesh::cl_type;
+        using index_t                    = typename Mesh::index_t;
+
+        Box<double, dim> box({0., 0.}, {1., 1.});
+        Mesh mesh{box, 2, 4};
+
+        auto stencil = make_stencil_analyzer(star_stencil<dim, 1>());
+        StencilConnectivity<Mesh, 5> connectivity;
+
+        auto check = [&]()
+        {
+            std::vector<std::array<index_t, 5>> expected;
+            std::vector<std::array<index_t, 5>> computed;
+            auto push = [](auto& list)
+            {
+                return [&](const auto& cells)
+                {
+                    std::array<index_t, 5> indices;
+                    for (std::size_t s = 0; s < cells.size(); ++s)
+                    {
+                        indices[s] = cells[s].index;
+                    }
+                    list.push_back(indices);
+                };
+            };
+            for_each_stencil(mesh, stencil, push(expected));
+            for_each_stencil(mesh, stencil, connectivity, push(computed));
+            EXPECT_EQ(expected.size(), mesh.nb_cells(mesh_id_t::cells));
+            EXPECT_EQ(expected, computed);
+        };
+
+        check();
+        check(); // the connectivity is reused
+
+        // coarsen all the cells: the connectivity must be rebuilt after the swap
+        cl_type cl;
+        for_each_interval(mesh[mesh_id_t::cells],
+                          [&](std::size_t level, const auto& i, const auto& index)
+                          {
+                              cl[level - 1][index >> 1].add_interval(i >> 1);
+                          });
+        Mesh new_mesh{cl, mesh};
+        auto old_version = mesh.version();
+        mesh.swap(new_mesh);
+        EXPECT_NE(mesh.version(), old_version);
+        check();
+    }
+
+    TEST(stencil, tiled_connectivity)
+    {
+        static constexpr std::size_t dim = 3;
+        using Config                     = MRConfig<dim, 2>;
+        using Mesh                       = MRMesh<Config>;
+        using index_t                    = typename Mesh::index_t;
+
+        Box<double, dim> box({0., 0., 0.}, {1., 1., 1.});
+        Mesh mesh{box, 4, 4};
+
+        // the stencil reads 5 z-planes: the rows are traversed by tiles of 1 row
+        auto stencil             = make_stencil_analyzer(star_stencil<dim, 2>());
+        auto tile_bytes          = args::stencil_tile_bytes;
+        args::stencil_tile_bytes = 1;
+
+        StencilConnectivity<Mesh, 13> connectivity;
+        std::vector<std::array<index_t, 13>> expected;
+        std::vector<std::array<index_t, 13>> computed;
+        auto push = [](auto& list)
+        {
+            return [&](const auto& cells)
+            {
+                std::array<index_t, 13> indices;
+                for (std::size_t s = 0; s < cells.size(); ++s)
+                {
+                    indices[s] = cells[s].index;
+                }
+                list.push_back(indices);
+            };
+        };
+        for_each_stencil(mesh, stencil, push(expected));
+        for_each_stencil(mesh, stencil, connectivity, push(computed));
+        // rows_per_tile() reads the current tile size: checked before it is restored
+        EXPECT_EQ(connectivity.rows_per_tile(4), 1U);
+        args::stencil_tile_bytes = tile_bytes;
+
+        EXPECT_NE(expected, computed);
+        std::sort(expected.begin(), expected.end());
+        std::sort(computed.begin(), computed.end());
+        EXPECT_EQ(expected, computed);
+    }
+
+    TEST(numbering, leaves_first)
+    {
+        static constexpr std::size_t dim = 2;
+        using Config                     = MRConfig<dim>;
+        using mesh_t                     = MRMesh<Config>;
+        using mesh_id_t                  = typename mesh_t::mesh_id_t;
+        using index_t                    = typename mesh_t::index_t;
+
+        auto init = [](const auto& x)
+        {
+            return std::exp(-50 * ((x[0] - 0.2) * (x[0] - 0.2) + x[1] * x[1]));
+        };
+
+        Box<double, dim> box({-1., -1.}, {1., 1.});
+        mesh_t rows{box, 2, 6};
+        auto u = make_scalar_field<double>("u", rows, init);
+        make_bc<Dirichlet<1>>(u, 0.);
+        auto MRadaptation = make_MRAdapt(u);
+        MRadaptation(1e-3, 1.);
+
+        args::numbering = CellNumbering::LeavesFirst;
+        mesh_t leaves_first{rows[mesh_id_t::cells], rows.min_level(), rows.max_level()};
+        args::numbering = CellNumbering::Rows;
+
+        EXPECT_EQ(rows.numbering(), CellNumbering::Rows);
+        EXPECT_EQ(leaves_first.numbering(), CellNumbering::LeavesFirst);
+        ASSERT_EQ(leaves_first.nb_cells(), rows.nb_cells());
+
+        // each cell of the reference mesh has its own storage index
+        std::vector<bool> used(leaves_first.nb_cells(), false);
+        for_each_interval(leaves_first[mesh_id_t::reference],
+                          [&](std::size_t, const auto& i, const auto&)
+                          {
+                              for (auto x = i.start; x < i.end; ++x)
+                              {
+                                  auto n = static_cast<std::size_t>(i.index + x);
+                                  ASSERT_LT(n, used.size());
+                                  EXPECT_FALSE(used[n]);
+                                  used[n] = true;
+                              }
+                          });
+        EXPECT_TRUE(std::all_of(used.begin(), used.end(),
+                                [](bool b)
+                                {
+                                    return b;
+                                }));
+
+        // the leaves of a level are stored closer to each other
+        for (std::size_t level = rows.min_level(); level <= rows.max_level(); ++level)
+        {
+            auto span = [&](const auto& mesh)
+            {
+                index_t min = std::numeric_limits<index_t>::max();
+                index_t max = std::numeric_limits<index_t>::min();
+                for_each_interval(mesh[mesh_id_t::cells][level],
+                                  [&](std::size_t, const auto& i, const auto&)
+                                  {
+                                      min = std::min(min, i.index + i.start);
+                                      max = std::max(max, i.index + i.end);
+                                  });
+                return max - min;
+            };
+            EXPECT_LE(span(leaves_first), span(rows));
+        }
+
+        // same values after the update of the ghosts
+        auto v = make_scalar_field<double>("v", leaves_first);
+        make_bc<Dirichlet<1>>(v, 0.);
+        for_each_cell(rows,
+                      [&](const auto& cell)
+                      {
+                          v[leaves_first.get_cell(cell.level, cell.indices)] = u[cell];
+                      });
+        update_ghost_mr(u);
+        update_ghost_mr(v);
+        for_each_interval(rows[mesh_id_t::reference],
+                          [&](std::size_t level, const auto& i, const auto& index)
+                          {
+                              EXPECT_TRUE(compare(u(level, i, index), v(level, i, index)));
+                          });
+    }
 }
@@ -0,0 +1,76 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <highfive/H5File.hpp>
+
+#include <samurai/field.hpp>
+#include <samurai/io/hdf5.hpp>
+#include <samurai/mr/mesh.hpp>
+
+namespace samurai
+{
+    TEST(hdf5, compact_round_trip)
+    {
+        static constexpr std::size_t dim = 2;
+        using Config                     = MRConfig<dim>;
+        using Mesh                       = MRMesh<Config>;
+        using mesh_id_t                  = typename Mesh::mesh_id_t;
+        using value_t                    = typename Mesh::interval_t::value_t;
+        using cl_type                    = typename Mesh::cl_type;
+        using ca_type                    = typename Mesh::ca_type;
+
+        // level 1 everywhere except the upper right quarter, refined at level 2
+        cl_type cl;
+        cl[1][{0}].add_interval({0, 2});
+        cl[1][{1}].add_interval({0, 1});
+        cl[2][{2}].add_interval({2, 4});
+        cl[2][{3}].add_interval({2, 4});
+        Mesh mesh(cl, 1, 2);
+
+        auto u = make_scalar_field<double>("u", mesh);
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          u[cell] = cell.center(0) + 10 * cell.center(1);
+                      });
+
+        save(fs::current_path(), "compact", {false, false, true}, mesh, u);
+
+        HighFive::File file("compact.h5", HighFive::File::ReadOnly);
+        auto intervals_dataset = file.getDataSet("/mesh/intervals");
+
+        std::vector<std::vector<value_t>> intervals;
+        intervals_dataset.read(intervals);
+        std::vector<double> origin_point;
+        intervals_dataset.getAttribute("origin_point").read(origin_point);
+        double scaling_factor;
+        intervals_dataset.getAttribute("scaling_factor").read(scaling_factor);
+        std::vector<double> values;
+        file.getDataSet("/mesh/fields/u").read(values);
+
+        EXPECT_EQ(origin_point, std::vector<double>(mesh.origin_point().cbegin(), mesh.origin_point().cend()));
+        EXPECT_EQ(scaling_factor, mesh.scaling_factor());
+
+        // the mesh rebuilt from the intervals is the saved one
+        cl_type cl_read;
+        for (const auto& row : intervals)
+        {
+            ASSERT_EQ(row.size(), dim + 2);
+            cl_read[static_cast<std::size_t>(row[0])][{row[3]}].add_interval({row[1], row[2]});
+        }
+        EXPECT_TRUE(ca_type(cl_read) == mesh[mesh_id_t::cells]);
+
+        // the fields are saved in the order of the intervals
+        ASSERT_EQ(values.size(), mesh.nb_cells(mesh_id_t::cells));
+        std::size_t index = 0;
+        for (const auto& row : intervals)
+        {
+            auto level = static_cast<std::size_t>(row[0]);
+            for (value_t i = row[1]; i < row[2]; ++i)
+            {
+                EXPECT_EQ(values[index++], u[mesh.get_cell(level, i, row[3])]);
+            }
+        }
+    }
+}
@@ -1,6 +1,9 @@
+#include <random>
+
 #include <gtest/gtest.h>
 #include <xtensor/xarray.hpp>
 
+#include <samurai/level_cell_array.hpp>
 #include <samurai/level_cell_list.hpp>
 
 namespace samurai
@@ -11,4 +14,68 @@ namespace samurai
         LevelCellList<dim> lcl;
         lcl[{0}].add_interval({-3, 3});
     }
+
+    template <typename T>
+    class flat_level_cell_list_test : public ::testing::Test
+    {
+    };
+
+    using flat_level_cell_list_test_types = ::testing::Types<std::integral_constant<std::size_t, 1>,
+                                                             std::integral_constant<std::size_t, 2>,
+                                                             std::integral_constant<std::size_t, 3>>;
+
+    TYPED_TEST_SUITE(flat_level_cell_list_test, flat_level_cell_list_test_types, );
+
+    TYPED_TEST(flat_level_cell_list_test, same_as_level_cell_list)
+    {
+        static constexpr std::size_t dim = TypeParam::value;
+        using lcl_t                      = LevelCellList<dim>;
+        using flat_lcl_t                 = FlatLevelCellList<dim>;
+        using index_yz_t                 = typename lcl_t::index_yz_t;
+
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<int> coord(-20, 20);
+        std::uniform_int_distribution<int> length(1, 4);
+
+        lcl_t lcl(4);
+        flat_lcl_t flat_lcl(4);
+
+        // small lists are sorted with std::sort, large ones with the radix sort
+        for (std::size_t nb_intervals : {10, 5000})
+        {
+            for (std::size_t k = 0; k < nb_intervals; ++k)
+            {
+                index_yz_t index;
+                for (auto& i : index)
+                {
+                    i = coord(gen);
+                }
+                int start = coord(gen);
+                int end   = start + length(gen);
+                lcl[index].add_interval({start, end});
+                flat_lcl[index].add_interval({start, end});
+            }
+            index_yz_t origin;
+            origin.fill(0);
+            flat_lcl[origin].add_interval({3, 3}); // empty interval: ignored
+
+            LevelCellArray<dim> lca(lcl);
+            LevelCellArray<dim> flat_lca(flat_lcl);
+            EXPECT_EQ(lca, flat_lca);
+            EXPECT_EQ(lca.nb_cells(), flat_lca.nb_cells());
+        }
+    }
+
+    TEST(flat_level_cell_list, empty)
+    {
+        FlatLevelCellList<2> lcl(3);
+        EXPECT_TRUE(lcl.empty());
+
+        lcl[{1}].add_point(3);
+        EXPECT_FALSE(lcl.empty());
+
+        lcl.clear();
+        EXPECT_TRUE(lcl.empty());
+        EXPECT_TRUE(LevelCellArray<2>(lcl).empty());
+    }
 }
@@ -0,0 +1,139 @@
+#include <array>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <samurai/field.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/schemes/fv.hpp>
+
+namespace samurai
+{
+    TEST(local_newton_solvers, dense_lu_solve)
+    {
+        // the first pivot is zero: the rows must be swapped
+        std::array<std::array<double, 3>, 3> A{
+            {{0., 2., 1.}, {1., 1., 1.}, {4., -1., 2.}}
+        };
+        std::array<double, 3> x{1., -2., 3.};
+        std::array<double, 3> b;
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            b[i] = A[i][0] * x[0] + A[i][1] * x[1] + A[i][2] * x[2];
+        }
+        ASSERT_TRUE(detail::dense_lu_solve(A, b));
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            EXPECT_NEAR(b[i], x[i], 1e-12);
+        }
+
+        std::array<std::array<double, 2>, 2> singular{
+            {{1., 2.}, {2., 4.}}
+        };
+        std::array<double, 2> c{1., 1.};
+        EXPECT_FALSE(detail::dense_lu_solve(singular, c));
+    }
+
+    TEST(local_newton_solvers, scalar_reaction)
+    {
+        static constexpr std::size_t dim = 1;
+        using Config                     = MRConfig<dim>;
+
+        Box<double, dim> box({-1.}, {1.});
+        auto mesh = MRMesh<Config>(box, 2, 5);
+
+        const double k  = 10;
+        const double dt = 0.1;
+
+        auto u   = make_scalar_field<double>("u", mesh);
+        auto rhs = make_scalar_field<double>("rhs", mesh);
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          rhs[cell] = 0.5 * (1 + std::tanh(4 * cell.center(0)));
+                      });
+        u = rhs;
+
+        using cfg  = LocalCellSchemeConfig<SchemeType::NonLinear, 1, decltype(u)>;
+        auto react = make_cell_based_scheme<cfg>();
+        react.set_scheme_function(
+            [&](const auto& cell, const auto& field) -> SchemeValue<cfg>
+            {
+                auto v = field[cell];
+                return k * v * v * (1 - v);
+            });
+        react.set_jacobian_function(
+            [&](const auto& cell, const auto& field) -> JacobianMatrix<cfg>
+            {
+                auto v = field[cell];
+                return k * (2 * v * (1 - v) - v * v);
+            });
+        auto id = make_identity<decltype(u)>();
+
+        auto solver = make_local_newton_solvers(id - dt * react);
+        solver.set_tolerances(1e-14, 1e-14, 0);
+        solver.solve(u, rhs);
+
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          double v = u[cell];
+                          EXPECT_NEAR(v - dt * k * v * v * (1 - v), rhs[cell], 1e-10);
+                      });
+    }
+
+    TEST(local_newton_solvers, coupled_components)
+    {
+        static constexpr std::size_t dim = 2;
+        using Config                     = MRConfig<dim>;
+
+        Box<double, dim> box({0., 0.}, {1., 1.});
+        auto mesh = MRMesh<Config>(box, 2, 3);
+
+        auto u   = make_vector_field<double, 2>("u", mesh, 1.);
+        auto rhs = make_vector_field<double, 2>("rhs", mesh);
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          rhs[cell][0] = 2 + cell.center(0);
+                          rhs[cell][1] = cell.center(1);
+                      });
+
+        // F(a, b) = (a + a*b, b - a^2)
+        using cfg = LocalCellSchemeConfig<SchemeType::NonLinear, 2, decltype(u)>;
+        auto op   = make_cell_based_scheme<cfg>();
+        op.set_scheme_function(
+            [](const auto& cell, const auto& field) -> SchemeValue<cfg>
+            {
+                auto v = field[cell];
+                SchemeValue<cfg> value;
+                value(0) = v(0) + v(0) * v(1);
+                value(1) = v(1) - v(0) * v(0);
+                return value;
+            });
+        op.set_jacobian_function(
+            [](const auto& cell, const auto& field) -> JacobianMatrix<cfg>
+            {
+                auto v = field[cell];
+                JacobianMatrix<cfg> jac;
+                jac(0, 0) = 1 + v(1);
+                jac(0, 1) = v(0);
+                jac(1, 0) = -2 * v(0);
+                jac(1, 1) = 1;
+                return jac;
+            });
+
+        auto solver = make_local_newton_solvers(op);
+        solver.set_tolerances(1e-14, 1e-14, 0);
+        solver.solve(u, rhs);
+
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          double a = u[cell][0];
+                          double b = u[cell][1];
+                          EXPECT_NEAR(a + a * b, rhs[cell][0], 1e-10);
+                          EXPECT_NEAR(b - a * a, rhs[cell][1], 1e-10);
+                      });
+    }
+}
@@ -0,0 +1,101 @@
+#include <cmath>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include <samurai/algorithm/update.hpp>
+#include <samurai/box.hpp>
+#include <samurai/field.hpp>
+#include <samurai/load_balancing.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/subset/node.hpp>
+
+namespace samurai
+{
+    TEST(mpi_load_balancing, weighted_repartition)
+    {
+        static constexpr std::size_t dim = 2;
+        using Config                     = MRConfig<dim>;
+        using Mesh                       = MRMesh<Config>;
+        using mesh_id_t                  = typename Mesh::mesh_id_t;
+
+        const double threshold = 0.05;
+
+        Box<double, dim> box({0., 0.}, {1., 1.});
+        Mesh mesh(box, 2, 6);
+
+        auto exact = [](const auto& x)
+        {
+            return x(0) + 10 * x(1);
+        };
+        auto u = make_scalar_field<double>("u", mesh);
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          u[cell] = exact(cell.center());
+                      });
+
+        // the cells of the lower left quarter are 8 times more expensive:
+        // the initial partition into stripes is unbalanced
+        auto weight = [](const auto& cell)
+        {
+            return cell.center(0) < 0.25 && cell.center(1) < 0.25 ? 8. : 1.;
+        };
+
+        mpi::communicator world;
+        auto global_nb_cells = [&]()
+        {
+            return mpi::all_reduce(world, mesh.nb_cells(mesh_id_t::cells), std::plus<std::size_t>());
+        };
+        auto integral = [&]()
+        {
+            double local_integral = 0;
+            for_each_cell(mesh,
+                          [&](auto& cell)
+                          {
+                              local_integral += u[cell] * std::pow(cell.length, dim);
+                          });
+            return mpi::all_reduce(world, local_integral, std::plus<double>());
+        };
+
+        auto nb_cells_before = global_nb_cells();
+        auto integral_before = integral();
+        ASSERT_GT(load_imbalance(mesh, weight), threshold);
+
+        EXPECT_TRUE(load_balancing(threshold, weight, u));
+
+        EXPECT_EQ(global_nb_cells(), nb_cells_before);
+        EXPECT_EQ(global_nb_cells(), mesh.domain().nb_cells());
+        EXPECT_NEAR(integral(), integral_before, 1e-12 * std::abs(integral_before));
+        EXPECT_LE(load_imbalance(mesh, weight), threshold);
+
+        // the values have migrated with their cells
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          EXPECT_EQ(u[cell], exact(cell.center()));
+                      });
+
+        // the ghosts received from the new neighbours are the values of their cells
+        update_ghost_subdomains(u);
+        for (const auto& neighbour : mesh.mpi_neighbourhood())
+        {
+            for (std::size_t level = mesh.min_level(); level <= mesh.max_level(); ++level)
+            {
+                auto received = intersection(neighbour.mesh[mesh_id_t::cells][level], mesh[mesh_id_t::reference][level]).on(level);
+                received(
+                    [&](const auto& i, const auto& index)
+                    {
+                        for (auto x = i.start; x < i.end; ++x)
+                        {
+                            auto cell = mesh.get_cell(level, x, index);
+                            EXPECT_EQ(u[cell], exact(cell.center()));
+                        }
+                    });
+            }
+        }
+
+        // balanced: nothing to do
+        EXPECT_FALSE(load_balancing(threshold, weight, u));
+    }
+}
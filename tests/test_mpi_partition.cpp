@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <samurai/arguments.hpp>
+#include <samurai/box.hpp>
+#include <samurai/mr/mesh.hpp>
+
+namespace samurai
+{
+    /**
+     * The subdomains of the initial mesh cover the domain without overlapping.
+     * With a space-filling curve, their numbers of cells differ by one at most.
+     */
+    template <std::size_t dim>
+    void check_initial_partition(MeshPartitioner partitioner, std::size_t min_level, std::size_t max_level)
+    {
+        using Config    = MRConfig<dim>;
+        using Mesh      = MRMesh<Config>;
+        using mesh_id_t = typename Mesh::mesh_id_t;
+        using ca_type   = typename Mesh::ca_type;
+        using cl_type   = typename Mesh::cl_type;
+
+        auto default_partitioner = args::partitioner;
+        args::partitioner        = partitioner;
+
+        using point_t = typename Box<double, dim>::point_t;
+        point_t box_corner1, box_corner2;
+        box_corner1.fill(0);
+        box_corner2.fill(1);
+        Box<double, dim> box(box_corner1, box_corner2);
+        Mesh mesh(box, min_level, max_level);
+
+        args::partitioner = default_partitioner;
+
+        mpi::communicator world;
+        std::vector<ca_type> subdomains;
+        mpi::all_gather(world, mesh[mesh_id_t::cells], subdomains);
+
+        cl_type cl(mesh.origin_point(), mesh.scaling_factor());
+        std::vector<std::size_t> nb_cells;
+        for (const auto& subdomain : subdomains)
+        {
+            EXPECT_EQ(subdomain.min_level(), max_level);
+            EXPECT_EQ(subdomain.max_level(), max_level);
+            nb_cells.push_back(subdomain.nb_cells());
+            for_each_interval(subdomain,
+                              [&](std::size_t level, const auto& i, const auto& index)
+                              {
+                                  cl[level][index].add_interval(i);
+                              });
+        }
+        ca_type all_cells(cl, false);
+
+        // the union of the subdomains is the domain, and the subdomains do not overlap
+        EXPECT_TRUE(all_cells[max_level] == mesh.domain());
+        std::size_t total = 0;
+        for (auto n : nb_cells)
+        {
+            total += n;
+        }
+        EXPECT_EQ(total, mesh.domain().nb_cells());
+
+        if (partitioner != MeshPartitioner::Intervals)
+        {
+            auto [min_cells, max_cells] = std::minmax_element(nb_cells.begin(), nb_cells.end());
+            EXPECT_LE(*max_cells - *min_cells, std::size_t{1});
+        }
+    }
+
+    TEST(mpi_partition, intervals)
+    {
+        check_initial_partition<1>(MeshPartitioner::Intervals, 2, 7);
+        check_initial_partition<2>(MeshPartitioner::Intervals, 2, 5);
+        check_initial_partition<3>(MeshPartitioner::Intervals, 2, 4);
+    }
+
+    TEST(mpi_partition, morton)
+    {
+        check_initial_partition<2>(MeshPartitioner::Morton, 2, 5);
+        check_initial_partition<3>(MeshPartitioner::Morton, 2, 4);
+    }
+
+    TEST(mpi_partition, hilbert)
+    {
+        check_initial_partition<2>(MeshPartitioner::Hilbert, 2, 5);
+        check_initial_partition<3>(MeshPartitioner::Hilbert, 2, 4);
+    }
+}
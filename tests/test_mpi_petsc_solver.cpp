@@ -0,0 +1,142 @@
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+
+#include <gtest/gtest.h>
+
+#include <samurai/box.hpp>
+#include <samurai/field.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/petsc.hpp>
+
+namespace samurai
+{
+    /**
+     * Backward Euler step of the heat equation, solved with the linear solver on all the MPI processes.
+     *
+     * The run on a single process writes its solution to a file, which the distributed runs compare with
+     * (see the FIXTURES of tests/CMakeLists.txt): the solutions agree within the tolerance of the KSP.
+     */
+    class mpi_petsc_solver : public ::testing::Test
+    {
+      protected:
+
+        static constexpr std::size_t dim = 2;
+        using Config                     = MRConfig<dim>;
+        using Mesh                       = MRMesh<Config>;
+        using cell_key_t                 = std::array<long long, dim + 1>; // level, i, j
+
+        static constexpr double rtol           = 1e-10;
+        static constexpr const char* reference = "mpi_petsc_solver_reference.txt";
+
+        static void SetUpTestSuite()
+        {
+            PetscInitializeNoArguments();
+        }
+
+        static void TearDownTestSuite()
+        {
+            PetscFinalize();
+        }
+
+        template <class Field>
+        static void heat_step(Field& u)
+        {
+            auto& mesh = u.mesh();
+
+            auto rhs = make_scalar_field<double>("rhs", mesh);
+            for_each_cell(mesh,
+                          [&](auto& cell)
+                          {
+                              auto x    = cell.center();
+                              rhs[cell] = std::exp(-50 * ((x(0) - 0.6) * (x(0) - 0.6) + (x(1) - 0.6) * (x(1) - 0.6)));
+                          });
+            u.fill(0);
+            make_bc<Dirichlet<1>>(u, 1.);
+
+            DiffCoeff<dim> K;
+            K.fill(1.);
+            auto diff       = make_diffusion_order2<Field>(K);
+            auto id         = make_identity<Field>();
+            auto back_euler = id + 0.01 * diff;
+
+            auto solver = petsc::make_solver(back_euler);
+            KSPSetTolerances(solver.Ksp(), rtol, 0., PETSC_DEFAULT, 10000);
+            solver.solve(u, rhs);
+        }
+
+        template <class Cell>
+        static cell_key_t key(const Cell& cell)
+        {
+            return {static_cast<long long>(cell.level), static_cast<long long>(cell.indices[0]), static_cast<long long>(cell.indices[1])};
+        }
+    };
+
+    TEST_F(mpi_petsc_solver, serial_reference)
+    {
+        mpi::communicator world;
+        if (world.size() > 1)
+        {
+            GTEST_SKIP() << "The reference solution is computed on a single process";
+        }
+
+        Box<double, dim> box({0., 0.}, {1., 1.});
+        Mesh mesh(box, 3, 5);
+        auto u = make_scalar_field<double>("u", mesh);
+        heat_step(u);
+
+        std::ofstream file(reference);
+        file.precision(std::numeric_limits<double>::max_digits10);
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          for (auto k : key(cell))
+                          {
+                              file << k << " ";
+                          }
+                          file << u[cell] << "\n";
+                      });
+        ASSERT_TRUE(file.good());
+    }
+
+    TEST_F(mpi_petsc_solver, distributed_heat)
+    {
+        mpi::communicator world;
+        if (world.size() == 1)
+        {
+            GTEST_SKIP() << "The distributed solve runs on several processes";
+        }
+
+        std::ifstream file(reference);
+        ASSERT_TRUE(file.good()) << "Run the test on a single process first to write " << reference;
+        std::map<cell_key_t, double> serial;
+        cell_key_t k;
+        double value;
+        while (file >> k[0] >> k[1] >> k[2] >> value)
+        {
+            serial[k] = value;
+        }
+
+        Box<double, dim> box({0., 0.}, {1., 1.});
+        Mesh mesh(box, 3, 5);
+        auto u = make_scalar_field<double>("u", mesh);
+        heat_step(u);
+
+        // the subdomains cover the cells of the serial mesh...
+        std::size_t nb_cells = 0;
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          ++nb_cells;
+                          auto it = serial.find(key(cell));
+                          ASSERT_NE(it, serial.end());
+                          // ... and the solutions differ by at most rtol times the condition number of the system
+                          // and the norm of the solution
+                          EXPECT_NEAR(u[cell], it->second, 1e4 * rtol);
+                      });
+        EXPECT_EQ(mpi::all_reduce(world, nb_cells, std::plus<std::size_t>()), serial.size());
+    }
+}
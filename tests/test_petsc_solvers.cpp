@@ -0,0 +1,96 @@
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <samurai/field.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/petsc.hpp>
+
+namespace samurai
+{
+    class petsc_solvers : public ::testing::Test
+    {
+      protected:
+
+        static void SetUpTestSuite()
+        {
+            PetscInitializeNoArguments();
+        }
+
+        static void TearDownTestSuite()
+        {
+            PetscFinalize();
+        }
+    };
+
+    /**
+     * Backward Euler steps of the heat equation on a two-level mesh: the assembled and the matrix-free
+     * solvers solve the same systems, so that their solutions agree within the tolerance of the KSP.
+     */
+    TEST_F(petsc_solvers, matrix_free_heat)
+    {
+        static constexpr std::size_t dim = 2;
+        using Config                     = MRConfig<dim>;
+        using Mesh                       = MRMesh<Config>;
+        using cl_type                    = typename Mesh::cl_type;
+
+        // level 4 everywhere except the upper right quarter, refined at level 5
+        cl_type cl;
+        for (int j = 0; j < 16; ++j)
+        {
+            cl[4][{j}].add_interval({0, j < 8 ? 16 : 8});
+        }
+        for (int j = 16; j < 32; ++j)
+        {
+            cl[5][{j}].add_interval({16, 32});
+        }
+        Mesh mesh(cl, 4, 5);
+
+        auto rhs = make_scalar_field<double>("rhs", mesh);
+        for_each_cell(mesh,
+                      [&](auto& cell)
+                      {
+                          auto x    = cell.center();
+                          rhs[cell] = std::exp(-50 * ((x(0) - 0.6) * (x(0) - 0.6) + (x(1) - 0.6) * (x(1) - 0.6)));
+                      });
+
+        // non-homogeneous boundary conditions: the matrix-free solver moves them to the right-hand side
+        auto u_assembled   = make_scalar_field<double>("u_assembled", mesh, 0.);
+        auto u_matrix_free = make_scalar_field<double>("u_matrix_free", mesh, 0.);
+        make_bc<Dirichlet<1>>(u_assembled, 1.);
+        make_bc<Dirichlet<1>>(u_matrix_free, 1.);
+
+        DiffCoeff<dim> K;
+        K.fill(1.);
+        auto diff       = make_diffusion_order2<decltype(u_assembled)>(K);
+        auto id         = make_identity<decltype(u_assembled)>();
+        auto back_euler = id + 0.01 * diff;
+
+        const double rtol = 1e-10;
+
+        auto assembled = petsc::make_solver(back_euler);
+        KSPSetTolerances(assembled.Ksp(), rtol, 0., PETSC_DEFAULT, 10000);
+        auto matrix_free = petsc::make_matrix_free_solver(back_euler);
+        KSPSetTolerances(matrix_free.Ksp(), rtol, 0., PETSC_DEFAULT, 10000);
+
+        // several time steps with the same solvers, the mesh being unchanged
+        auto rhs_assembled   = rhs;
+        auto rhs_matrix_free = rhs;
+        for (std::size_t nt = 0; nt < 3; ++nt)
+        {
+            assembled.solve(u_assembled, rhs_assembled);
+            matrix_free.solve(u_matrix_free, rhs_matrix_free);
+
+            // both residuals are below rtol relative to the right-hand side: the solutions differ by
+            // at most rtol times the condition number of the system and the norm of the solution
+            for_each_cell(mesh,
+                          [&](auto& cell)
+                          {
+                              EXPECT_NEAR(u_matrix_free[cell], u_assembled[cell], 1e4 * rtol);
+                          });
+
+            rhs_assembled   = u_assembled;
+            rhs_matrix_free = u_matrix_free;
+        }
+    }
+}
@@ -55,4 +55,138 @@ namespace samurai
         auto p = portion<1>(u, 5, interval_t{2, 3}, 2, 2, 4, 0, 0, 0);
         EXPECT_EQ(p[0], 3 * ((2 << 4) + .5) / (1 << 9));
     }
+
+    TEST(portion, prediction_conservation)
+    {
+        // the predictions of the 2^delta_l children sum to 2^delta_l times the value of the parent cell
+        for (std::size_t delta_l = 0; delta_l < 5; ++delta_l)
+        {
+            int nb_children = 1 << delta_l;
+            prediction_map<1, int> sum;
+            for (int ii = 0; ii < nb_children; ++ii)
+            {
+                sum += prediction<2, int>(delta_l, ii);
+            }
+            for (const auto& kv : sum.coeff)
+            {
+                EXPECT_NEAR(kv.second, kv.first[0] == 0 ? nb_children : 0., 1e-12);
+            }
+
+            prediction_map<2, int> sum_2d;
+            for (int jj = 0; jj < nb_children; ++jj)
+            {
+                for (int ii = 0; ii < nb_children; ++ii)
+                {
+                    sum_2d += prediction<2, int>(delta_l, ii, jj);
+                }
+            }
+            for (const auto& kv : sum_2d.coeff)
+            {
+                EXPECT_NEAR(kv.second, (kv.first[0] == 0 && kv.first[1] == 0) ? nb_children * nb_children : 0., 1e-12);
+            }
+        }
+    }
+
+    // Former recursive definition of the prediction coefficients, without its cache
+    template <std::size_t order>
+    prediction_map<1, int> reference_prediction(std::size_t level, int i)
+    {
+        if (level == 0)
+        {
+            return prediction_map<1, int>{{i}};
+        }
+        int ig      = i >> 1;
+        double sign = (i & 1) ? -1. : 1.;
+
+        auto values = reference_prediction<order>(level - 1, ig);
+        auto interp = interp_coeffs<2 * order + 1>(sign);
+        for (std::size_t ci = 0; ci < interp.size(); ++ci)
+        {
+            if (ci != order)
+            {
+                values += interp[ci] * reference_prediction<order>(level - 1, ig + static_cast<int>(ci) - static_cast<int>(order));
+            }
+        }
+        return values;
+    }
+
+    template <std::size_t order>
+    prediction_map<2, int> reference_prediction(std::size_t level, int i, int j)
+    {
+        if (level == 0)
+        {
+            return prediction_map<2, int>{
+                {i, j}
+            };
+        }
+        int ig       = i >> 1;
+        int jg       = j >> 1;
+        double isign = (i & 1) ? -1. : 1.;
+        double jsign = (j & 1) ? -1. : 1.;
+
+        auto values  = reference_prediction<order>(level - 1, ig, jg);
+        auto interpx = interp_coeffs<2 * order + 1>(isign);
+        auto interpy = interp_coeffs<2 * order + 1>(jsign);
+        for (std::size_t ci = 0; ci < interpx.size(); ++ci)
+        {
+            for (std::size_t cj = 0; cj < interpy.size(); ++cj)
+            {
+                if (ci != order || cj != order)
+                {
+                    values += interpx[ci] * interpy[cj]
+                            * reference_prediction<order>(level - 1,
+                                                          ig + static_cast<int>(ci) - static_cast<int>(order),
+                                                          jg + static_cast<int>(cj) - static_cast<int>(order));
+                }
+            }
+        }
+        return values;
+    }
+
+    // The coefficients of both maps are equal, a missing coefficient being 0
+    template <std::size_t dim>
+    void expect_same_prediction(const prediction_map<dim, int>& actual, const prediction_map<dim, int>& expected)
+    {
+        for (const auto& [key, value] : expected.coeff)
+        {
+            auto it = actual.coeff.find(key);
+            EXPECT_NEAR(it == actual.coeff.end() ? 0. : it->second, value, 1e-14);
+        }
+        for (const auto& [key, value] : actual.coeff)
+        {
+            auto it = expected.coeff.find(key);
+            EXPECT_NEAR(value, it == expected.coeff.end() ? 0. : it->second, 1e-14);
+        }
+    }
+
+    template <std::size_t order>
+    void check_prediction_against_reference(std::size_t max_delta_l)
+    {
+        for (std::size_t delta_l = 0; delta_l <= max_delta_l; ++delta_l)
+        {
+            // children of the coarse cell 0 and of its neighbours
+            int nb_children = 1 << delta_l;
+            for (int ii = -nb_children; ii < 2 * nb_children; ++ii)
+            {
+                expect_same_prediction(prediction<order, int>(delta_l, ii), reference_prediction<order>(delta_l, ii));
+            }
+            if (delta_l <= 2) // the 2D recursion is expensive
+            {
+                for (int jj = -1; jj <= nb_children; ++jj)
+                {
+                    for (int ii = -1; ii <= nb_children; ++ii)
+                    {
+                        expect_same_prediction(prediction<order, int>(delta_l, ii, jj), reference_prediction<order>(delta_l, ii, jj));
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(portion, prediction_reference)
+    {
+        check_prediction_against_reference<1>(6);
+        check_prediction_against_reference<2>(5);
+        check_prediction_against_reference<3>(4);
+    }
 }
@@ -0,0 +1,243 @@
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <xtensor/xfixed.hpp>
+
+#include <samurai/arguments.hpp>
+#include <samurai/field.hpp>
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/mr/operators.hpp>
+#include <samurai/numeric/prediction.hpp>
+
+namespace samurai
+{
+    template <typename T>
+    class prediction_kernels : public ::testing::Test
+    {
+    };
+
+    using prediction_kernels_types = ::testing::
+        Types<std::integral_constant<std::size_t, 1>, std::integral_constant<std::size_t, 2>, std::integral_constant<std::size_t, 3>>;
+
+    TYPED_TEST_SUITE(prediction_kernels, prediction_kernels_types, );
+
+    /**
+     * Periodic mesh refined around a bump, so that the prediction and the details
+     * are computed on several levels and across the periodic boundaries.
+     */
+    template <std::size_t dim, std::size_t prediction_order>
+    auto make_adapted_mesh()
+    {
+        using Config = MRConfig<dim, 2, default_config::graduation_width, prediction_order>;
+
+        xt::xtensor_fixed<double, xt::xshape<dim>> min_corner, max_corner;
+        min_corner.fill(-1);
+        max_corner.fill(1);
+        Box<double, dim> box(min_corner, max_corner);
+        std::array<bool, dim> periodic;
+        periodic.fill(true);
+        std::size_t min_level = 2;
+        std::size_t max_level = dim == 3 ? 5 : 6;
+        MRMesh<Config> mesh{box, min_level, max_level, periodic};
+
+        auto u = make_scalar_field<double>("u",
+                                           mesh,
+                                           [](const auto& x)
+                                           {
+                                               return std::exp(-20 * xt::sum(x * x)());
+                                           });
+        auto MRadaptation = make_MRAdapt(u);
+        MRadaptation(1e-3, 1.);
+        return mesh;
+    }
+
+    template <class Field>
+    void init_field(Field& f)
+    {
+        f.fill(0);
+        for_each_cell(f.mesh(),
+                      [&](const auto& cell)
+                      {
+                          auto x = cell.center();
+                          for (std::size_t c = 0; c < Field::n_comp; ++c)
+                          {
+                              double v = std::sin(3 * x[0] + static_cast<double>(c));
+                              for (std::size_t d = 1; d < Field::dim; ++d)
+                              {
+                                  v *= std::cos(2 * x[d] - static_cast<double>(c));
+                              }
+                              if constexpr (Field::is_scalar)
+                              {
+                                  f[cell] = v;
+                              }
+                              else
+                              {
+                                  f[cell][c] = v;
+                              }
+                          }
+                      });
+    }
+
+    template <class Field>
+    void expect_same_values(const Field& generic, const Field& kernel)
+    {
+        ASSERT_EQ(generic.array().size(), kernel.array().size());
+        const auto* g = generic.array().data();
+        const auto* k = kernel.array().data();
+        for (std::size_t n = 0; n < static_cast<std::size_t>(generic.array().size()); ++n)
+        {
+            EXPECT_NEAR(g[n], k[n], 1e-13) << "at position " << n << " of the storage of " << generic.name();
+        }
+    }
+
+    /**
+     * Computes the details of the fields like the adaptation does, on the ghosts below the cells.
+     */
+    template <class Detail, class Fields>
+    void compute_details(Detail& detail, Fields& fields)
+    {
+        auto& mesh      = detail.mesh();
+        using mesh_id_t = typename Detail::mesh_t::mesh_id_t;
+
+        detail.fill(0);
+        for (std::size_t level = mesh.min_level() - 1; level < mesh.max_level(); ++level)
+        {
+            auto ghosts_below_cells = intersection(mesh[mesh_id_t::all_cells][level], mesh[mesh_id_t::cells][level + 1]).on(level);
+            ghosts_below_cells.apply_op(compute_detail(detail, fields));
+        }
+    }
+
+    template <class Field>
+    void check_prediction(Field& u)
+    {
+        init_field(u);
+        auto generic = u;
+        auto kernel  = u;
+
+        args::disable_mr_kernels = true;
+        update_ghost_mr(generic);
+        args::disable_mr_kernels = false;
+        update_ghost_mr(kernel);
+
+        expect_same_values(generic, kernel);
+    }
+
+    template <class Detail, class Fields>
+    void check_detail(Detail& detail_generic, Detail& detail_kernel, Fields& fields)
+    {
+        args::disable_mr_kernels = true;
+        compute_details(detail_generic, fields);
+        args::disable_mr_kernels = false;
+        compute_details(detail_kernel, fields);
+
+        expect_same_values(detail_generic, detail_kernel);
+    }
+
+    /**
+     * The kernels are really used on the adapted mesh: they apply to rows of the cells of the finest level,
+     * predicted from the level below, and to the details of their parents, unless they are disabled.
+     */
+    template <std::size_t prediction_order, class Field>
+    void expect_kernels_applied(Field& u)
+    {
+        using mesh_id_t = typename Field::mesh_t::mesh_id_t;
+
+        auto& mesh        = u.mesh();
+        std::size_t level = mesh.max_level();
+        auto predicted    = u;
+        auto details      = u;
+
+        std::size_t n_rows        = 0;
+        std::size_t n_predictions = 0;
+        for_each_interval(mesh[mesh_id_t::cells],
+                          [&](std::size_t cells_level, const auto& i, const auto& index)
+                          {
+                              if (cells_level == level)
+                              {
+                                  ++n_rows;
+                                  if (detail::prediction_kernel<prediction_order, false>(predicted, u, level, i, index))
+                                  {
+                                      ++n_predictions;
+                                  }
+                              }
+                          });
+        EXPECT_GT(n_rows, 0u);
+        EXPECT_GT(n_predictions, 0u);
+
+        std::size_t n_parent_rows = 0;
+        std::size_t n_details     = 0;
+        auto parents = intersection(mesh[mesh_id_t::all_cells][level - 1], mesh[mesh_id_t::cells][level]).on(level - 1);
+        parents(
+            [&](const auto& i, const auto& index)
+            {
+                ++n_parent_rows;
+                if (detail::detail_kernel<prediction_order>(details, u, level - 1, i, index))
+                {
+                    ++n_details;
+                }
+            });
+        EXPECT_GT(n_parent_rows, 0u);
+        EXPECT_GT(n_details, 0u);
+
+        args::disable_mr_kernels = true;
+        parents(
+            [&](const auto& i, const auto& index)
+            {
+                EXPECT_FALSE(detail::detail_kernel<prediction_order>(details, u, level - 1, i, index));
+            });
+        args::disable_mr_kernels = false;
+    }
+
+    template <std::size_t dim, std::size_t prediction_order>
+    void check_kernels()
+    {
+        auto mesh = make_adapted_mesh<dim, prediction_order>();
+
+        auto u     = make_scalar_field<double>("u", mesh);
+        auto v_aos = make_vector_field<double, 2>("v_aos", mesh);
+        auto v_soa = make_vector_field<double, 3, true>("v_soa", mesh);
+
+        check_prediction(u);
+        check_prediction(v_aos);
+        check_prediction(v_soa);
+
+        update_ghost_mr(u);
+        update_ghost_mr(v_aos);
+        update_ghost_mr(v_soa);
+
+        expect_kernels_applied<prediction_order>(u);
+        expect_kernels_applied<prediction_order>(v_aos);
+        expect_kernels_applied<prediction_order>(v_soa);
+
+        auto du_generic = make_scalar_field<double>("du_generic", mesh);
+        auto du_kernel  = make_scalar_field<double>("du_kernel", mesh);
+        check_detail(du_generic, du_kernel, u);
+
+        auto dv_generic = make_vector_field<double, 3, true>("dv_generic", mesh);
+        auto dv_kernel  = make_vector_field<double, 3, true>("dv_kernel", mesh);
+        check_detail(dv_generic, dv_kernel, v_soa);
+
+        // details of several fields stored in the components of a single field
+        auto fields         = Field_tuple(u, v_aos);
+        auto dtuple_generic = make_vector_field<double, 3>("dtuple_generic", mesh);
+        auto dtuple_kernel  = make_vector_field<double, 3>("dtuple_kernel", mesh);
+        check_detail(dtuple_generic, dtuple_kernel, fields);
+    }
+
+    TYPED_TEST(prediction_kernels, order_0)
+    {
+        check_kernels<TypeParam::value, 0>();
+    }
+
+    TYPED_TEST(prediction_kernels, order_1)
+    {
+        check_kernels<TypeParam::value, 1>();
+    }
+
+    TYPED_TEST(prediction_kernels, order_2)
+    {
+        check_kernels<TypeParam::value, 2>();
+    }
+}
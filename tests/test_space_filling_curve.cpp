@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <samurai/space_filling_curve.hpp>
+
+namespace samurai
+{
+    // The Hilbert curve visits every point of the grid once, going from a point to one of its neighbours.
+    template <std::size_t dim>
+    void check_hilbert_continuity(std::size_t bits)
+    {
+        std::size_t n     = std::size_t{1} << bits;
+        std::size_t total = 1;
+        for (std::size_t d = 0; d < dim; ++d)
+        {
+            total *= n;
+        }
+
+        std::map<sfc::key_type, std::array<sfc::key_type, dim>> points;
+        for (std::size_t c = 0; c < total; ++c)
+        {
+            std::array<sfc::key_type, dim> x;
+            std::size_t r = c;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                x[d] = r % n;
+                r /= n;
+            }
+            points[sfc::hilbert_key(x, bits)] = x;
+        }
+        ASSERT_EQ(points.size(), total);
+        EXPECT_EQ(points.rbegin()->first, total - 1);
+
+        auto previous = points.begin()->second;
+        for (auto it = std::next(points.begin()); it != points.end(); ++it)
+        {
+            long distance = 0;
+            for (std::size_t d = 0; d < dim; ++d)
+            {
+                distance += std::labs(static_cast<long>(it->second[d]) - static_cast<long>(previous[d]));
+            }
+            EXPECT_EQ(distance, 1);
+            previous = it->second;
+        }
+    }
+
+    TEST(space_filling_curve, hilbert_continuity)
+    {
+        check_hilbert_continuity<2>(4);
+        check_hilbert_continuity<3>(3);
+    }
+
+    TEST(space_filling_curve, multilevel_keys)
+    {
+        sfc::CurveIndexer<2, int> indexer(sfc::Curve::Hilbert, 4, {-8, -8}, {8, 8});
+
+        // a cell has the key of its first child at the reference level
+        EXPECT_EQ(indexer(2, 1, std::array<int, 1>{-1}), indexer(4, 4, std::array<int, 1>{-4}));
+
+        // the children of a cell are contiguous on the curve
+        std::vector<sfc::key_type> children;
+        for (int j = 2; j < 4; ++j)
+        {
+            for (int i = 2; i < 4; ++i)
+            {
+                children.push_back(indexer(4, i, std::array<int, 1>{j}));
+            }
+        }
+        std::sort(children.begin(), children.end());
+        EXPECT_EQ(children.back() - children.front(), 3u);
+        EXPECT_EQ(children.front(), indexer(3, 1, std::array<int, 1>{1}));
+    }
+
+    TEST(space_filling_curve, split_curve)
+    {
+        std::vector<sfc::weighted_key> keys;
+        for (sfc::key_type k = 0; k < 100; ++k)
+        {
+            keys.push_back({99 - k, k < 50 ? 1. : 3.}); // the 50 first keys on the curve weigh 3
+        }
+        auto splitters = sfc::split_curve(keys, 4);
+
+        std::array<double, 4> weights{};
+        for (const auto& k : keys)
+        {
+            weights[sfc::part_of(splitters, k.key)] += k.weight;
+        }
+        for (auto w : weights)
+        {
+            EXPECT_NEAR(w, 50., 3.);
+        }
+    }
+
+    TEST(space_filling_curve, sample_curve)
+    {
+        std::vector<sfc::weighted_key> keys;
+        for (sfc::key_type k = 0; k < 1000; ++k)
+        {
+            keys.push_back({k, k < 500 ? 1. : 3.});
+        }
+        auto samples = sfc::sample_curve(keys, 20);
+        EXPECT_LE(samples.size(), 20u);
+
+        double total_weight = 0;
+        for (const auto& s : samples)
+        {
+            total_weight += s.weight;
+        }
+        EXPECT_DOUBLE_EQ(total_weight, 2000.);
+
+        // the splitters computed on the samples cut the whole curve into nearly equal pieces
+        auto splitters = sfc::split_curve(samples, 4);
+        std::array<double, 4> weights{};
+        for (const auto& k : keys)
+        {
+            weights[sfc::part_of(splitters, k.key)] += k.weight;
+        }
+        for (auto w : weights)
+        {
+            EXPECT_NEAR(w, 500., 100.);
+        }
+    }
+}
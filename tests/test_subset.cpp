@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstddef>
 #include <filesystem>
 #include <span>
@@ -12,6 +13,7 @@
 #include <samurai/level_cell_array.hpp>
 #include <samurai/mr/mesh.hpp>
 #include <samurai/subset/node.hpp>
+#include <samurai/subset/parallel_apply.hpp>
 #include <xtensor/xtensor_forward.hpp>
 
 namespace samurai
@@ -1319,4 +1321,93 @@ namespace samurai
         EXPECT_TRUE(intersection(lca, translate(lca, translation)).empty());
     }
 
+    /**
+     * Intervals of the set found by apply and by parallel_apply, sorted by row.
+     */
+    template <class Set>
+    void check_parallel_apply(Set&& set)
+    {
+        static constexpr std::size_t dim = std::decay_t<Set>::dim;
+        using interval_t                 = typename std::decay_t<Set>::interval_t;
+        using row_interval_t             = std::pair<std::array<int, dim - 1>, interval_t>;
+
+        auto to_row_interval = [](const auto& i, const auto& index)
+        {
+            std::array<int, dim - 1> row;
+            for (std::size_t d = 0; d < dim - 1; ++d)
+            {
+                row[dim - 2 - d] = index[d];
+            }
+            return row_interval_t{row, i};
+        };
+        auto less = [](const row_interval_t& a, const row_interval_t& b)
+        {
+            return a.first < b.first || (a.first == b.first && a.second.start < b.second.start);
+        };
+
+        std::vector<row_interval_t> expected;
+        apply(set,
+              [&](const auto& i, const auto& index)
+              {
+                  expected.push_back(to_row_interval(i, index));
+              });
+
+        std::vector<row_interval_t> result;
+        parallel_apply(set,
+                       [&](const auto& i, const auto& index)
+                       {
+#pragma omp critical
+                           result.push_back(to_row_interval(i, index));
+                       });
+        std::sort(result.begin(), result.end(), less);
+
+        EXPECT_FALSE(expected.empty());
+        EXPECT_TRUE(std::is_sorted(expected.begin(), expected.end(), less));
+        EXPECT_EQ(expected, result);
+    }
+
+    TEST(subset, parallel_apply_2d)
+    {
+        CellList<2> cl;
+        CellArray<2> ca;
+
+        for (int y = -20; y < 20; ++y)
+        {
+            cl[5][{y}].add_interval({-20 + (y * y) % 7, 20 - (y * y) % 5});
+            cl[6][{2 * y}].add_interval({(y % 3) * 4, 40 + y});
+            cl[6][{2 * y + 1}].add_interval({-40, -30 + y % 4});
+        }
+        ca = {cl, true};
+
+        xt::xtensor_fixed<int, xt::xshape<2>> dir{1, -2};
+
+        check_parallel_apply(self(ca[5]));
+        check_parallel_apply(intersection(ca[5], ca[6]).on(5));
+        check_parallel_apply(union_(ca[5], translate(ca[6], dir)).on(6));
+        check_parallel_apply(difference(ca[6], translate(ca[5], dir).on(6)));
+        check_parallel_apply(union_(ca[5], ca[6]).on(3));
+    }
+
+    TEST(subset, parallel_apply_3d)
+    {
+        CellList<3> cl;
+        CellArray<3> ca;
+
+        for (int z = -8; z < 8; ++z)
+        {
+            for (int y = -8; y < 8; ++y)
+            {
+                cl[3][{y, z}].add_interval({-8 + (y * z) % 3, 8 - (y + z) % 2});
+                cl[4][{2 * y, 2 * z + 1}].add_interval({(y - z) % 5, 16});
+            }
+        }
+        ca = {cl, true};
+
+        xt::xtensor_fixed<int, xt::xshape<3>> dir{0, 1, -1};
+
+        check_parallel_apply(self(ca[3]));
+        check_parallel_apply(union_(ca[3], ca[4]).on(4));
+        check_parallel_apply(difference(ca[3], translate(ca[4], dir)).on(3));
+        check_parallel_apply(intersection(ca[3], contract(ca[3], 1)).on(2));
+    }
 }
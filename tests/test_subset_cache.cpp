@@ -0,0 +1,154 @@
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <xtensor/xfixed.hpp>
+
+#include <samurai/bc.hpp>
+#include <samurai/cell_array.hpp>
+#include <samurai/cell_list.hpp>
+#include <samurai/field.hpp>
+#include <samurai/mr/adapt.hpp>
+#include <samurai/mr/mesh.hpp>
+#include <samurai/subset/node.hpp>
+#include <samurai/subset_cache.hpp>
+
+namespace samurai
+{
+    auto make_cell_array()
+    {
+        CellList<2> cl;
+        CellArray<2> ca;
+        for (int y = -8; y < 8; ++y)
+        {
+            cl[3][{y}].add_interval({-8 + (y * y) % 5, 8});
+            cl[4][{2 * y}].add_interval({-16, (y % 3) * 4});
+        }
+        ca = {cl, true};
+        return ca;
+    }
+
+    TEST(subset_cache, materialized_subset)
+    {
+        using interval_t = typename CellArray<2>::interval_t;
+        using index_t    = xt::xtensor_fixed<int, xt::xshape<1>>;
+
+        auto ca = make_cell_array();
+        xt::xtensor_fixed<int, xt::xshape<2>> dir{1, 1};
+
+        auto set = union_(ca[3], translate(ca[4], dir)).on(3);
+        std::vector<std::pair<interval_t, index_t>> expected;
+        set(
+            [&](const auto& i, const auto& index)
+            {
+                expected.emplace_back(i, index);
+            });
+
+        MaterializedSubset<2, interval_t> materialized(set);
+        EXPECT_EQ(materialized.level(), 3U);
+        EXPECT_EQ(materialized.size(), expected.size());
+
+        std::size_t n = 0;
+        materialized(
+            [&](const auto& i, const auto& index)
+            {
+                ASSERT_LT(n, expected.size());
+                EXPECT_EQ(i, expected[n].first);
+                EXPECT_EQ(index, expected[n].second);
+                ++n;
+            });
+        EXPECT_EQ(n, expected.size());
+    }
+
+    TEST(subset_cache, mesh_version)
+    {
+        using interval_t = typename CellArray<2>::interval_t;
+
+        auto ca = make_cell_array();
+        SubsetCache<2, interval_t> cache;
+
+        int n_builds  = 0;
+        auto make_set = [&]()
+        {
+            ++n_builds;
+            return intersection(ca[3], ca[4]).on(3);
+        };
+
+        const auto& set = cache.get(1, {"set", 3}, make_set);
+        EXPECT_FALSE(set.empty());
+        cache.get(1, {"set", 3}, make_set);
+        EXPECT_EQ(n_builds, 1);
+
+        cache.get(1, {"set", 3, {1, 0}}, make_set);
+        EXPECT_EQ(n_builds, 2);
+        EXPECT_EQ(cache.size(), 2U);
+
+        // a new version of the mesh drops the sets of the previous one
+        cache.get(2, {"set", 3}, make_set);
+        EXPECT_EQ(n_builds, 3);
+        EXPECT_EQ(cache.size(), 1U);
+    }
+
+    TEST(subset_cache, ghost_update)
+    {
+        static constexpr std::size_t dim = 2;
+        using Config                     = MRConfig<dim>;
+        using mesh_id_t                  = typename MRMesh<Config>::mesh_id_t;
+
+        Box<double, dim> box({-1., -1.}, {1., 1.});
+        MRMesh<Config> mesh{box, 2, 6};
+
+        auto u = make_scalar_field<double>("u",
+                                           mesh,
+                                           [](const auto& x)
+                                           {
+                                               return std::exp(-20 * (x[0] * x[0] + x[1] * x[1]));
+                                           });
+        make_bc<Dirichlet<1>>(u, 0.);
+
+        auto MRadaptation = make_MRAdapt(u);
+        MRadaptation(1e-3, 1.);
+
+        // ghosts computed from the cached sets and from sets evaluated again
+        auto warm = u;
+        update_ghost_mr(warm);
+        EXPECT_GT(mesh.subset_cache().size(), 0U);
+        update_ghost_mr(warm);
+
+        auto cold = u;
+        mesh.subset_cache().clear();
+        update_ghost_mr(cold);
+
+        ASSERT_EQ(warm.array().size(), cold.array().size());
+        for (std::size_t n = 0; n < static_cast<std::size_t>(warm.array().size()); ++n)
+        {
+            EXPECT_EQ(warm.array().data()[n], cold.array().data()[n]);
+        }
+
+        // the sets are evaluated again once the mesh has changed
+        auto level    = mesh.max_level();
+        int n_builds  = 0;
+        auto make_set = [&]()
+        {
+            ++n_builds;
+            return intersection(mesh[mesh_id_t::cells][level], mesh[mesh_id_t::reference][level - 1]).on(level - 1);
+        };
+        cached_subset(mesh, {"test", level}, make_set);
+        cached_subset(mesh, {"test", level}, make_set);
+        EXPECT_EQ(n_builds, 1);
+
+        auto version = mesh.version();
+        for_each_cell(mesh,
+                      [&](const auto& cell)
+                      {
+                          u[cell] = std::exp(-20 * ((cell.center(0) - 0.5) * (cell.center(0) - 0.5) + cell.center(1) * cell.center(1)));
+                      });
+        MRadaptation(1e-3, 1.);
+        ASSERT_NE(version, mesh.version());
+
+        cached_subset(mesh, {"test", level}, make_set);
+        EXPECT_EQ(n_builds, 2);
+    }
+}